@@ -506,7 +506,7 @@
             Iimport=Iimport+1
             scale=-1.0_r8/(rho0*Cp)       ! Watts/m2 to Celsius m/s
             add_offset=0.0_r8
-            CALL ROMS_import2d (ng, MyRank,                             &
+            CALL ROMS_import2d (ng, MyTile,                             &
      &                          id, gtype, scale, add_offset,           &
      &                          Asize, A                                &
      &                          IstrR, IendR, JstrR, JendR,             &
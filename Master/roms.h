@@ -68,6 +68,9 @@
       logical, save :: first
 
       integer :: ng, MyError
+#ifdef HYBRID_OMP
+      integer :: provided
+#endif
 
 #ifdef DISTRIBUTE
 # ifdef MPI
@@ -76,7 +79,18 @@
 !  Initialize distributed-memory MPI configuration.
 !-----------------------------------------------------------------------
 !
+#  ifdef HYBRID_OMP
+!
+!  In hybrid distributed/shared-memory applications, only the master
+!  thread of each process makes MPI calls.
+!
+      CALL mpi_init_thread (MPI_THREAD_FUNNELED, provided, MyError)
+      IF ((MyError.eq.0).and.(provided.lt.MPI_THREAD_FUNNELED)) THEN
+        MyError=1
+      END IF
+#  else
       CALL mpi_init (MyError)
+#  endif
       IF (MyError.ne.0) THEN
         WRITE (stdout,10)
   10    FORMAT (/,' ROMS/TOMS - Unable to initialize MPI.')
@@ -168,6 +168,7 @@ export     MY_PROJECT_DIR=${PWD}
  export         which_MPI=openmpi       # compile with OpenMPI library
 
 #export        USE_OpenMP=on            # shared-memory parallelism
+                                        # (hybrid if USE_MPI is also on)
 
  export              FORT=ifort
 #export              FORT=gfortran
@@ -277,13 +278,6 @@ fi
 
  cd ${MY_ROMS_SRC}
 
-# Stop if activating both MPI and OpenMP at the same time.
-
-if [ -n "${USE_MPI:+1}" ] && [ -n "${USE_OpenMP:+1}" ]; then
-  echo "You cannot activate USE_MPI and USE_OpenMP at the same time!"
-  exit 1
-fi
-
 #--------------------------------------------------------------------------
 # Compile.
 #--------------------------------------------------------------------------
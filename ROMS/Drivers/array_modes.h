@@ -228,10 +228,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -532,7 +532,7 @@
         Fcount=INI(ng)%load
         INI(ng)%Nrec(Fcount)=1
 #ifdef DISTRIBUTE
-        CALL wrt_ini (ng, MyRank, 1)
+        CALL wrt_ini (ng, MyTile, 1)
 #else
         CALL wrt_ini (ng, -1, 1)
 #endif
@@ -1019,7 +1019,7 @@
 !
             DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 # else
               CALL ad_wrt_his (ng, -1)
 # endif
@@ -1033,7 +1033,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 # else
               CALL ad_wrt_his (ng, -1)
 # endif
@@ -1061,7 +1061,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -1226,7 +1226,7 @@
 !
         DO ng=1,Ngrids
 #  ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #  else
           CALL ad_wrt_his (ng, -1)
 #  endif
@@ -1239,7 +1239,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #  ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #  else
           CALL ad_wrt_his (ng, -1)
 #  endif
@@ -1266,7 +1266,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 #  ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #  else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #  endif
@@ -1511,7 +1511,7 @@
 !
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL ad_wrt_his (ng, MyRank)
+        CALL ad_wrt_his (ng, MyTile)
 #else
         CALL ad_wrt_his (ng, -1)
 #endif
@@ -1524,7 +1524,7 @@
       WRTforce=.FALSE.
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL ad_wrt_his (ng, MyRank)
+        CALL ad_wrt_his (ng, MyTile)
 #else
         CALL ad_wrt_his (ng, -1)
 #endif
@@ -1551,7 +1551,7 @@
       DO ng=1,Ngrids
         TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-        CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+        CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
         CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -2029,7 +2029,7 @@
           blowup=exit_flag
           exit_flag=NoError
 #ifdef DISTRIBUTE
-          CALL wrt_rst (ng, MyRank)
+          CALL wrt_rst (ng, MyTile)
 #else
           CALL wrt_rst (ng, -1)
 #endif
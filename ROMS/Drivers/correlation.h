@@ -418,7 +418,7 @@
         Ladjusted(ng)=.TRUE.
 #endif
 #ifdef DISTRIBUTE
-        CALL ad_wrt_his (ng, MyRank)
+        CALL ad_wrt_his (ng, MyTile)
 #else
         CALL ad_wrt_his (ng, -1)
 #endif
@@ -466,7 +466,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
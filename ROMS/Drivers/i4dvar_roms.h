@@ -196,10 +196,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -333,7 +333,7 @@
           IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) RETURN
 !
 #ifdef DISTRIBUTE
-          CALL wrt_dai (ng, MyRank)
+          CALL wrt_dai (ng, MyTile)
 #else
           CALL wrt_dai (ng, -1)
 #endif
@@ -348,7 +348,7 @@
       IF (exit_flag.eq.NoError) THEN
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL stats_modobs (ng, MyRank)
+        CALL stats_modobs (ng, MyTile)
 #else
         CALL stats_modobs (ng, -1)
 #endif
@@ -375,7 +375,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -123,6 +123,14 @@
 !
         CALL inp_par (iNLM)
         IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) RETURN
+#ifdef CONCURRENT_NESTING
+!
+!  Split the communicator, so the nested grids in each layer are
+!  advanced concurrently on disjoint sets of processes.
+!
+        CALL split_nesting
+        IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) RETURN
+#endif
 !
 !  Set domain decomposition tile partition range.  This range is
 !  computed only once since the "first_tile" and "last_tile" values
@@ -137,9 +145,22 @@
       MyThread=0
 #endif
       DO ng=1,Ngrids
+#if defined CONCURRENT_NESTING
+        IF (OwnGrid(ng)) THEN
+          first_tile(ng)=NestRank-GridRoot(ng)  ! single grid tile
+          last_tile (ng)=first_tile(ng)
+        ELSE
+          first_tile(ng)=0                      ! grid not advanced by
+          last_tile (ng)=-1                     ! the process
+        END IF
+#elif defined DROP_LAND_TILES
+        first_tile(ng)=MyTile               ! land tiles are not
+        last_tile (ng)=MyTile               ! assigned to processes
+#else
         chunk_size=(NtileX(ng)*NtileE(ng)+numthreads-1)/numthreads
         first_tile(ng)=MyThread*chunk_size
         last_tile (ng)=first_tile(ng)+chunk_size-1
+#endif
       END DO
 !$OMP END PARALLEL
 !
@@ -178,10 +199,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -191,9 +212,21 @@
 !  if applicable.
 !-----------------------------------------------------------------------
 !
+#ifdef OFFLINE_FLOATS
+!  In offline floats tracking, activate processing of the FWD structure
+!  containing the archived ocean state in routine "check_multifile".
+!
+      DO ng=1,Ngrids
+        LreadFWD(ng)=.TRUE.
+      END DO
+!
+#endif
 !$OMP PARALLEL
       CALL initial
 !$OMP END PARALLEL
+#ifdef CONCURRENT_NESTING
+      CALL assign_nesting (0)
+#endif
       IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) RETURN
 !
 !  Initialize run or ensemble counter.
@@ -247,6 +280,9 @@
 !  Local variable declarations.
 !
       integer :: ng
+#ifdef CONCURRENT_NESTING
+      integer :: MyError
+#endif
 #if defined MODEL_COUPLING && !defined MCT_LIB
       integer :: NstrStep, NendStep, extra
 !
@@ -288,17 +324,35 @@
       IF (Master) WRITE (stdout,'(1x)')
 !
 !$OMP PARALLEL
-#ifdef SOLVE3D
+#if defined SOLVE3D && defined OFFLINE_FLOATS
+      CALL main3d_offline (MyRunInterval)
+#elif defined SOLVE3D
       CALL main3d (MyRunInterval)
 #else
       CALL main2d (MyRunInterval)
 #endif
 !$OMP END PARALLEL
 
+#ifdef CONCURRENT_NESTING
+!
+!  The processes advancing the other nested grids are not aware of an
+!  error in the local grid and they are waiting in the next contact
+!  points exchange, so all the processes are terminated.
+!
+      IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) THEN
+        WRITE (stdout,20) TRIM(Rerror(exit_flag)), exit_flag, NestRank
+        CALL mpi_abort (NEST_COMM_WORLD, exit_flag, MyError)
+      END IF
+      CALL assign_nesting (0)
+#endif
       IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) RETURN
 !
  10   FORMAT (1x,a,1x,'ROMS/TOMS: started time-stepping:',              &
      &        ' (Grid: ',i2.2,' TimeSteps: ',i12.12,' - ',i12.12,')')
+#ifdef CONCURRENT_NESTING
+ 20   FORMAT (/,' ROMS_RUN - ',a,', exit_flag = ',i0,', Rank = ',i0,    &
+     &        /,11x,'aborting all the concurrent nested grids.')
+#endif
 !
       RETURN
       END SUBROUTINE ROMS_run
@@ -328,7 +382,7 @@
       IF (exit_flag.eq.NoError) THEN
         DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-          CALL wrt_dai (ng, MyRank)
+          CALL wrt_dai (ng, MyTile)
 # else
           CALL wrt_dai (ng, -1)
 # endif
@@ -343,7 +397,7 @@
 !
       DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-        CALL stats_modobs (ng, MyRank)
+        CALL stats_modobs (ng, MyTile)
 # else
         CALL stats_modobs (ng, -1)
 # endif
@@ -358,6 +412,10 @@
 !
       IF (exit_flag.eq.1) THEN
         DO ng=1,Ngrids
+#ifdef CONCURRENT_NESTING
+          IF (.not.OwnGrid(ng)) CYCLE
+          CALL assign_nesting (ng)
+#endif
           IF (LwrtRST(ng)) THEN
             IF (Master) WRITE (stdout,10) TRIM(blowup_string)
  10         FORMAT (/,' Blowing-up: Saving latest model state into ',   &
@@ -370,12 +428,15 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
           END IF
         END DO
+#ifdef CONCURRENT_NESTING
+        CALL assign_nesting (0)
+#endif
       END IF
 !
 !-----------------------------------------------------------------------
@@ -407,8 +468,15 @@
 !  Close IO files.
 !
       DO ng=1,Ngrids
+#ifdef CONCURRENT_NESTING
+        IF (.not.OwnGrid(ng)) CYCLE
+        CALL assign_nesting (ng)
+#endif
         CALL close_inp (ng, iNLM)
       END DO
+#ifdef CONCURRENT_NESTING
+      CALL assign_nesting (0)
+#endif
       CALL close_out
 !
       RETURN
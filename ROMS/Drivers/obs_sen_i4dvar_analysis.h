@@ -299,10 +299,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -1235,7 +1235,7 @@
 !
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL stats_modobs (ng, MyRank)
+        CALL stats_modobs (ng, MyTile)
 #else
         CALL stats_modobs (ng, -1)
 #endif
@@ -1261,7 +1261,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -223,10 +223,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -459,7 +459,7 @@
         Fcount=INI(ng)%load
         INI(ng)%Nrec(Fcount)=1
 #ifdef DISTRIBUTE
-        CALL wrt_ini (ng, MyRank, 1)
+        CALL wrt_ini (ng, MyTile, 1)
 #else
         CALL wrt_ini (ng, -1, 1)
 #endif
@@ -939,7 +939,7 @@
 !
             DO ng=1,Ngrids
 #  ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #  else
               CALL ad_wrt_his (ng, -1)
 #  endif
@@ -953,7 +953,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 #  ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #  else
               CALL ad_wrt_his (ng, -1)
 #  endif
@@ -981,7 +981,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 #  ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #  else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #  endif
@@ -1145,7 +1145,7 @@
 !
         DO ng=1,Ngrids
 #  ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #  else
           CALL ad_wrt_his (ng, -1)
 #  endif
@@ -1158,7 +1158,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #  ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #  else
           CALL ad_wrt_his (ng, -1)
 #  endif
@@ -1185,7 +1185,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 #  ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #  else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #  endif
@@ -1343,7 +1343,7 @@
 !!
 !!    DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-!!      CALL stats_modobs (ng, MyRank)
+!!      CALL stats_modobs (ng, MyTile)
 #else
 !!      CALL stats_modobs (ng, -1)
 #endif
@@ -1437,7 +1437,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1450,7 +1450,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1479,7 +1479,7 @@
 !!      DO ng=1,Ngrids
 !!        TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-!!        CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+!!        CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
 !!        CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1665,7 +1665,7 @@
 !
           DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-            CALL ad_wrt_his (ng, MyRank)
+            CALL ad_wrt_his (ng, MyTile)
 # else
             CALL ad_wrt_his (ng, -1)
 # endif
@@ -1678,7 +1678,7 @@
           DO ng=1,Ngrids
             WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-            CALL ad_wrt_his (ng, MyRank)
+            CALL ad_wrt_his (ng, MyTile)
 # else
             CALL ad_wrt_his (ng, -1)
 # endif
@@ -1707,7 +1707,7 @@
 !!        DO ng=1,Ngrids
 !!          TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-!!          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+!!          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
 !!          CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -2369,7 +2369,7 @@
 !
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL stats_modobs (ng, MyRank)
+        CALL stats_modobs (ng, MyTile)
 #else
         CALL stats_modobs (ng, -1)
 #endif
@@ -2395,7 +2395,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
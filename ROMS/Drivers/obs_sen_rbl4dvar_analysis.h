@@ -229,10 +229,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -518,7 +518,7 @@
         Fcount=INI(ng)%load
         INI(ng)%Nrec(Fcount)=1
 #ifdef DISTRIBUTE
-        CALL wrt_ini (ng, MyRank, 1)
+        CALL wrt_ini (ng, MyTile, 1)
 #else
         CALL wrt_ini (ng, -1, 1)
 #endif
@@ -956,7 +956,7 @@
 !
             DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 # else
               CALL ad_wrt_his (ng, -1)
 # endif
@@ -970,7 +970,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 # else
               CALL ad_wrt_his (ng, -1)
 # endif
@@ -998,7 +998,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -1134,7 +1134,7 @@
 !
         DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 # else
           CALL ad_wrt_his (ng, -1)
 # endif
@@ -1147,7 +1147,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 # else
           CALL ad_wrt_his (ng, -1)
 # endif
@@ -1174,7 +1174,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -1430,7 +1430,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1443,7 +1443,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1472,7 +1472,7 @@
 !!      DO ng=1,Ngrids
 !!        TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-!!        CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+!!        CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
 !!        CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1676,7 +1676,7 @@
 !
           DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-            CALL ad_wrt_his (ng, MyRank)
+            CALL ad_wrt_his (ng, MyTile)
 # else
             CALL ad_wrt_his (ng, -1)
 # endif
@@ -1689,7 +1689,7 @@
           DO ng=1,Ngrids
             WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-            CALL ad_wrt_his (ng, MyRank)
+            CALL ad_wrt_his (ng, MyTile)
 # else
             CALL ad_wrt_his (ng, -1)
 # endif
@@ -1719,7 +1719,7 @@
 !!        DO ng=1,Ngrids
 !!          TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-!!          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+!!          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
 !!          CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -2372,7 +2372,7 @@
 !
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL stats_modobs (ng, MyRank)
+        CALL stats_modobs (ng, MyTile)
 #else
         CALL stats_modobs (ng, -1)
 #endif
@@ -2398,7 +2398,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -232,10 +232,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -621,7 +621,7 @@
         Fcount=INI(ng)%load
         INI(ng)%Nrec(Fcount)=1
 #ifdef DISTRIBUTE
-        CALL wrt_ini (ng, MyRank, 1)
+        CALL wrt_ini (ng, MyTile, 1)
 #else
         CALL wrt_ini (ng, -1, 1)
 #endif
@@ -910,7 +910,7 @@
 !
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL ad_wrt_his (ng, MyRank)
+        CALL ad_wrt_his (ng, MyTile)
 #else
         CALL ad_wrt_his (ng, -1)
 #endif
@@ -924,7 +924,7 @@
         WRTforce(ng)=.FALSE.
         LwrtState2d(ng)=.FALSE.
 #ifdef DISTRIBUTE
-        CALL ad_wrt_his (ng, MyRank)
+        CALL ad_wrt_his (ng, MyTile)
 #else
         CALL ad_wrt_his (ng, -1)
 #endif
@@ -1046,7 +1046,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1060,7 +1060,7 @@
           WRTforce(ng)=.FALSE.
           LwrtState2d(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1282,7 +1282,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1296,7 +1296,7 @@
           WRTforce(ng)=.FALSE.
           LwrtState2d(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1325,7 +1325,7 @@
 !!      DO ng=1,Ngrids
 !!        TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-!!        CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+!!        CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
 !!        CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1723,7 +1723,7 @@
 !
           DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-            CALL ad_wrt_his (ng, MyRank)
+            CALL ad_wrt_his (ng, MyTile)
 # else
             CALL ad_wrt_his (ng, -1)
 # endif
@@ -1737,7 +1737,7 @@
             WRTforce(ng)=.FALSE.
             LwrtState2d(ng)=.FALSE.
 # ifdef DISTRIBUTE
-            CALL ad_wrt_his (ng, MyRank)
+            CALL ad_wrt_his (ng, MyTile)
 # else
             CALL ad_wrt_his (ng, -1)
 # endif
@@ -1767,7 +1767,7 @@
 !!        DO ng=1,Ngrids
 !!          TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-!!          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+!!          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
 !!          CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -2441,7 +2441,7 @@
 !
       DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-        CALL stats_modobs (ng, MyRank)
+        CALL stats_modobs (ng, MyTile)
 #else
         CALL stats_modobs (ng, -1)
 #endif
@@ -2467,7 +2467,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
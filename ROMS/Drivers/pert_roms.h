@@ -201,10 +201,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -363,10 +363,10 @@
 !
         DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-          Istr=BOUNDS(ng)%Istr(MyRank)
-          Iend=BOUNDS(ng)%Iend(MyRank)
-          Jstr=BOUNDS(ng)%Jstr(MyRank)
-          Jend=BOUNDS(ng)%Jend(MyRank)
+          Istr=BOUNDS(ng)%Istr(MyTile)
+          Iend=BOUNDS(ng)%Iend(MyTile)
+          Jstr=BOUNDS(ng)%Jstr(MyTile)
+          Jend=BOUNDS(ng)%Jend(MyTile)
           BOUNDED_TL=((Istr.le.IperTL).and.(IperTL.le.Iend)).and.       &
      &               ((Jstr.le.JperTL).and.(JperTL.le.Jend))
           BOUNDED_AD=((Istr.le.IperAD).and.(IperAD.le.Iend)).and.       &
@@ -478,10 +478,10 @@
 !
         DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-          Istr=BOUNDS(ng)%Istr(MyRank)
-          Iend=BOUNDS(ng)%Iend(MyRank)
-          Jstr=BOUNDS(ng)%Jstr(MyRank)
-          Jend=BOUNDS(ng)%Jend(MyRank)
+          Istr=BOUNDS(ng)%Istr(MyTile)
+          Iend=BOUNDS(ng)%Iend(MyTile)
+          Jstr=BOUNDS(ng)%Jstr(MyTile)
+          Jend=BOUNDS(ng)%Jend(MyTile)
           BOUNDED_AD=((Istr.le.IperAD).and.(IperAD.le.Iend)).and.       &
      &               ((Jstr.le.JperAD).and.(JperAD.le.Jend))
           BOUNDED_TL=((Istr.le.IperTL).and.(IperTL.le.Iend)).and.       &
@@ -698,7 +698,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -194,10 +194,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -620,7 +620,7 @@
      &                              state(ng)%vector)
                   END DO
 #ifdef DISTRIBUTE
-                  CALL ad_wrt_his (ng, MyRank)
+                  CALL ad_wrt_his (ng, MyTile)
 #else
                   CALL ad_wrt_his (ng, -1)
 #endif
@@ -780,7 +780,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -247,10 +247,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -456,7 +456,7 @@
           IF (FoundError(exit_flag, NoError, __LINE__, MyFile)) RETURN
 !
 #ifdef DISTRIBUTE
-          CALL wrt_dai (ng, MyRank)
+          CALL wrt_dai (ng, MyTile)
 #else
           CALL wrt_dai (ng, -1)
 #endif
@@ -471,7 +471,7 @@
       IF (Ldone.or.(exit_flag.eq.1)) THEN
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL stats_modobs (ng, MyRank)
+          CALL stats_modobs (ng, MyTile)
 #else
           CALL stats_modobs (ng, -1)
 #endif
@@ -498,7 +498,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -498,7 +498,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-          tile=MyRank
+          tile=MyTile
 #else
           tile=-1
 #endif
@@ -545,10 +545,10 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          Istr=BOUNDS(ng)%Istr(MyRank)
-          Iend=BOUNDS(ng)%Iend(MyRank)
-          Jstr=BOUNDS(ng)%Jstr(MyRank)
-          Jend=BOUNDS(ng)%Jend(MyRank)
+          Istr=BOUNDS(ng)%Istr(MyTile)
+          Iend=BOUNDS(ng)%Iend(MyTile)
+          Jstr=BOUNDS(ng)%Jstr(MyTile)
+          Jend=BOUNDS(ng)%Jend(MyTile)
           BOUNDED_TL=((Istr.le.IoutTL).and.(IoutTL.le.Iend)).and.       &
      &               ((Jstr.le.JoutTL).and.(JoutTL.le.Jend))
 #else
@@ -651,7 +651,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
@@ -218,10 +218,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -369,7 +369,7 @@
         Fcount=INI(ng)%load
         INI(ng)%Nrec(Fcount)=1
 #ifdef DISTRIBUTE
-        CALL wrt_ini (ng, MyRank, 1)
+        CALL wrt_ini (ng, MyTile, 1)
 #else
         CALL wrt_ini (ng, -1, 1)
 #endif
@@ -774,7 +774,7 @@
 !
             DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 # else
               CALL ad_wrt_his (ng, -1)
 # endif
@@ -788,7 +788,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 # else
               CALL ad_wrt_his (ng, -1)
 # endif
@@ -816,7 +816,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -979,7 +979,7 @@
 !
         DO ng=1,Ngrids
 # ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 # else
           CALL ad_wrt_his (ng, -1)
 # endif
@@ -992,7 +992,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 # ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 # else
           CALL ad_wrt_his (ng, -1)
 # endif
@@ -1019,7 +1019,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 # ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 # else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 # endif
@@ -1320,7 +1320,7 @@
 !
             DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #else
               CALL ad_wrt_his (ng, -1)
 #endif
@@ -1334,7 +1334,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #else
               CALL ad_wrt_his (ng, -1)
 #endif
@@ -1362,7 +1362,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1513,7 +1513,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1526,7 +1526,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1553,7 +1553,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1697,7 +1697,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
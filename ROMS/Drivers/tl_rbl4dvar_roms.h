@@ -221,10 +221,10 @@
 !
       DO ng=1,Ngrids
 # ifdef ATM_COUPLING
-        CALL initialize_ocn2atm_coupling (ng, MyRank)
+        CALL initialize_ocn2atm_coupling (ng, MyTile)
 # endif
 # ifdef WAV_COUPLING
-        CALL initialize_ocn2wav_coupling (ng, MyRank)
+        CALL initialize_ocn2wav_coupling (ng, MyTile)
 # endif
       END DO
 #endif
@@ -372,7 +372,7 @@
         Fcount=INI(ng)%load
         INI(ng)%Nrec(Fcount)=1
 #ifdef DISTRIBUTE
-        CALL wrt_ini (ng, MyRank, 1)
+        CALL wrt_ini (ng, MyTile, 1)
 #else
         CALL wrt_ini (ng, -1, 1)
 #endif
@@ -731,7 +731,7 @@
 !
             DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #else
               CALL ad_wrt_his (ng, -1)
 #endif
@@ -745,7 +745,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #else
               CALL ad_wrt_his (ng, -1)
 #endif
@@ -773,7 +773,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -924,7 +924,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -937,7 +937,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -964,7 +964,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1297,7 +1297,7 @@
 !
             DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #else
               CALL ad_wrt_his (ng, -1)
 #endif
@@ -1311,7 +1311,7 @@
             DO ng=1,Ngrids
               WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-              CALL ad_wrt_his (ng, MyRank)
+              CALL ad_wrt_his (ng, MyTile)
 #else
               CALL ad_wrt_his (ng, -1)
 #endif
@@ -1339,7 +1339,7 @@
             DO ng=1,Ngrids
               TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-              CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+              CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
               CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1485,7 +1485,7 @@
 !
         DO ng=1,Ngrids
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1498,7 +1498,7 @@
         DO ng=1,Ngrids
           WRTforce(ng)=.FALSE.
 #ifdef DISTRIBUTE
-          CALL ad_wrt_his (ng, MyRank)
+          CALL ad_wrt_his (ng, MyTile)
 #else
           CALL ad_wrt_his (ng, -1)
 #endif
@@ -1522,7 +1522,7 @@
         DO ng=1,Ngrids
           TLF(ng)%Rindex=0
 #ifdef DISTRIBUTE
-          CALL wrt_impulse (ng, MyRank, iADM, ADM(ng)%name)
+          CALL wrt_impulse (ng, MyTile, iADM, ADM(ng)%name)
 #else
           CALL wrt_impulse (ng, -1, iADM, ADM(ng)%name)
 #endif
@@ -1674,7 +1674,7 @@
             blowup=exit_flag
             exit_flag=NoError
 #ifdef DISTRIBUTE
-            CALL wrt_rst (ng, MyRank)
+            CALL wrt_rst (ng, MyTile)
 #else
             CALL wrt_rst (ng, -1)
 #endif
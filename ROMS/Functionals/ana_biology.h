@@ -69,9 +69,9 @@
       integer, intent(in) :: IminS, ImaxS, JminS, JmaxS
 !
 #ifdef ASSUMED_SHAPE
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
 #endif
 !
 !  Local variable declarations.
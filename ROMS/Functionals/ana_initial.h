@@ -153,7 +153,7 @@
 
       real(r8), intent(out) :: u(LBi:,LBj:,:,:)
       real(r8), intent(out) :: v(LBi:,LBj:,:,:)
-      real(r8), intent(out) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(out) :: t(LBi:,LBj:,:,:,:)
 # endif
       real(r8), intent(out) :: ubar(LBi:,LBj:,:)
       real(r8), intent(out) :: vbar(LBi:,LBj:,:)
@@ -172,7 +172,7 @@
 
       real(r8), intent(out) :: u(LBi:UBi,LBj:UBj,N(ng),2)
       real(r8), intent(out) :: v(LBi:UBi,LBj:UBj,N(ng),2)
-      real(r8), intent(out) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
+      real(rsp), intent(out) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
 # endif
       real(r8), intent(out) :: ubar(LBi:UBi,LBj:UBj,3)
       real(r8), intent(out) :: vbar(LBi:UBi,LBj:UBj,3)
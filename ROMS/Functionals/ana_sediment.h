@@ -99,7 +99,7 @@
       real(r8), intent(in) :: rho(LBi:,LBj:,:)
 # endif
 # ifdef SEDIMENT
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
       real(r8), intent(out) :: bed(LBi:,LBj:,:,:)
       real(r8), intent(out) :: bed_frac(LBi:,LBj:,:,:)
       real(r8), intent(out) :: bed_mass(LBi:,LBj:,:,:,:)
@@ -114,7 +114,7 @@
       real(r8), intent(in) :: rho(LBi:,LBj:,:)
 # endif
 # ifdef SEDIMENT
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
       real(r8), intent(out) :: bed(LBi:UBi,LBj:UBj,Nbed,MBEDP)
       real(r8), intent(out) :: bed_frac(LBi:UBi,LBj:UBj,Nbed,NST)
       real(r8), intent(out) :: bed_mass(LBi:UBi,LBj:UBj,Nbed,2,NST)
@@ -77,10 +77,10 @@
 
 #ifdef ASSUMED_SHAPE
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
-      real(r8), intent(in) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(in) :: t(LBi:,LBj:,:,:,:)
 #else
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,N(ng))
-      real(r8), intent(in) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
+      real(rsp), intent(in) :: t(LBi:UBi,LBj:UBj,N(ng),3,NT(ng))
 #endif
 !
 !  Local variable declarations.
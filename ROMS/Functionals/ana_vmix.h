@@ -83,15 +83,15 @@
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
       real(r8), intent(in) :: z_w(LBi:,LBj:,0:)
       real(r8), intent(in) :: zeta(LBi:,LBj:,:)
-      real(r8), intent(out) :: Akv(LBi:,LBj:,0:)
-      real(r8), intent(out) :: Akt(LBi:,LBj:,0:,:)
+      real(rsp), intent(out) :: Akv(LBi:,LBj:,0:)
+      real(rsp), intent(out) :: Akt(LBi:,LBj:,0:,:)
 #else
       real(r8), intent(in) :: h(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,N(ng))
       real(r8), intent(in) :: z_w(LBi:UBi,LBj:UBj,0:N(ng))
       real(r8), intent(in) :: zeta(LBi:UBi,LBj:UBj,3)
-      real(r8), intent(out) :: Akv(LBi:UBi,LBj:UBj,0:N(ng))
-      real(r8), intent(out) :: Akt(LBi:UBi,LBj:UBj,0:N(ng),NAT)
+      real(rsp), intent(out) :: Akv(LBi:UBi,LBj:UBj,0:N(ng))
+      real(rsp), intent(out) :: Akt(LBi:UBi,LBj:UBj,0:N(ng),NAT)
 #endif
 !
 !  Local variable declarations.
@@ -59,6 +59,9 @@
 ** T_PASSIVE               if inert passive tracers (dyes, etc)              **
 ** AGE_MEAN                if computing Mean Age of inert passive tracers    **
 ** NONLIN_EOS              if using nonlinear equation of state              **
+** VECTORIZED_EOS          if nonlinear equation of state in Horner form     **
+**                           vectorized by I-strips (results may differ in   **
+**                           the last bits from the default form)            **
 ** QCORRECTION             if net heat flux correction                       **
 ** SALINITY                if having salinity                                **
 ** SCORRECTION             if freshwater flux correction                     **
@@ -133,6 +136,7 @@
 ** SOLVE3D                 if solving 3D primitive equations                 **
 ** CURVGRID                if curvilinear coordinates grid                   **
 ** MASKING                 if land/sea masking                               **
+** WET_POINTS              if column physics loops only over wet points      **
 ** BODYFORCE               if applying stresses as bodyforces                **
 ** PROFILE                 if time profiling                                 **
 ** AVERAGES                if writing out NLM time-averaged data             **
@@ -144,18 +148,22 @@
 ** DIAGNOSTICS_UV          if writing out momentum diagnostics               **
 ** DIAGNOSTICS_TS          if writing out tracer diagnostics                 **
 ** ICESHELF                if including ice shelf cavities                   **
+** MIXED_PRECISION         if storing tracers and vertical mixing in 32-bit  **
 ** SINGLE_PRECISION        if single precision arithmetic numerical kernel   **
 ** SPHERICAL               if analytical spherical grid                      **
 ** STATIONS                if writing out station data                       **
 ** STATIONS_CGRID          if extracting data at native C-grid               **
+** STATIONS_GATHER         if sending station data to writer node only       **
 **                                                                           **
 ** OPTIONS for Lagrangian drifters:                                          **
 **                                                                           **
 ** FLOATS                  to activate simulated Lagrangian drifters         **
+** FLOAT_MIGRATION         to migrate floats between adjacent tiles (MPI)    **
 ** FLOAT_OYSTER            to activate oyster model behavior in floats       **
 ** FLOAT_STICKY            to reflect/stick floats that hit surface/bottom   **
 ** FLOAT_VWALK             if vertical random walk                           **
 ** VWALK_FORWARD           if forward time stepping vertical random walk     **
+** OFFLINE_FLOATS          to track floats offline with archived ocean state **
 **                                                                           **
 ** OPTIONS for analytical fields configuration:                              **
 **                                                                           **
@@ -492,6 +500,9 @@
 ** OPTIONS for grid nesting:                                                 **
 **                                                                           **
 ** NESTING                 to activate grid nesting: composite/refinement    **
+** CONCURRENT_NESTING      to advance layer grids on disjoint process sets   **
+**                           in composite grids only. With refinement grids  **
+**                           each grid must use all the processes            **
 ** NESTING_DEBUG           to check mass fluxes conservation in refinement   **
 ** NO_CORRECT_TRACER       to avoid two-way correction of boundary tracer    **
 ** ONE_WAY                 if one-way nesting in refinement grids            **
@@ -525,6 +536,19 @@
 ** NEARSHORE_MELLOR05      to activate radiation stress terms (Mellor 2005). **
 ** NEARSHORE_MELLOR08      to activate radiation stress terms (Mellor 2008). **
 **                                                                           **
+** Domain decomposition OPTIONS:                                             **
+**                                                                           **
+** BALANCED_TILES          to balance tile sizes by number of water points   **
+**                           with rectilinear cuts of the tile columns and   **
+**                           rows, not a recursive coordinate bisection      **
+** FUSED_KERNELS           to pipeline 3D predictor kernels by tile rows or  **
+**                           by J-strips of each node tile (optional NstripJ **
+**                           input keyword, default 1)                       **
+**                                                                           **
+** Shared-memory (OpenMP) OPTIONS:                                           **
+**                                                                           **
+** DYNAMIC_TILES           to schedule tiles dynamically to idle threads     **
+**                                                                           **
 ** MPI communication OPTIONS:  The routines "mp_assemble" (used in nesting), **
 **                             "mp_collect" (used in NetCDF I/O and 4D-Var), **
 ** and "mp_reduce" (used in global reductions) are coded in "distribution.F" **
@@ -550,11 +574,23 @@
 ** COLLECT_ALLGATHER   use "mpi_allgather" in "mp_collect"                   **
 ** COLLECT_ALLREDUCE   use "mpi_allreduce" in "mp_collect"                   **
 **                                                                           **
+** CONTACT_SENDRECV    use point-to-point nesting contact points exchange    **
+**                                                                           **
+** CORNER_EXCHANGE     use 8-neighbors single phase in "mp_exchange"         **
+**                                                                           **
+** DROP_LAND_TILES     remove tiles with only land points from partition     **
+**                                                                           **
+** PERSISTENT_EXCHANGE use persistent MPI requests in "mp_exchange"          **
+**                                                                           **
 ** REDUCE_ALLGATHER    use "mpi_allgather" in "mp_reduce"                    **
 ** REDUCE_ALLREDUCE    use "mpi_allreduce" in "mp_reduce"                    **
 **                                                                           **
+** WIDE_HALO_2D        exchange wide "step2d" halos every NfastHalo steps    **
+**                       (optional NfastHalo input keyword, default 2)       **
+**                                                                           **
 ** NetCDF input/output OPTIONS:                                              **
 **                                                                           **
+** ASYNCHRONOUS_PIO        if PIO library with dedicated I/O processes       **
 ** CHECKSUM                to report checksum when processing I/O            **
 ** CHECK_OPEN_FILES        to report number opened/closed/created files      **
 ** DEFLATE                 to set compression NetCDF-4/HDF5 format files     **
@@ -568,9 +604,11 @@
 ** PIO_LIB                 to include Parallel-IO from the PIO library       **
 ** PNETCDF                 if parallel I/O with pnetcdf (classic format)     **
 ** POSITIVE_ZERO           to impose positive zero in ouput data             **
+** PREFETCH_FORCING        to read ahead next record of gridded input fields **
 ** READ_WATER              if only reading water points data                 **
 ** REGRID_SHAPIRO          to apply Shapiro Filter to regridded data         **
 ** ROMS_STDOUT             to write standard output into the 'log.roms' file **
+** TILED_READ              if each node reads its input tile (serial NetCDF) **
 ** WRITE_WATER             if only writing water points data                 **
 ** RST_SINGLE              if writing single precision restart fields        **
 ** OUT_DOUBLE              if writing double precision output fields         **
@@ -193,6 +193,68 @@
 # define $OMP !
 #endif
 
+/*
+** The dynamic tile scheduler is only available in shared-memory
+** applications.
+*/
+
+#if defined DYNAMIC_TILES && !defined _OPENMP
+# undef DYNAMIC_TILES
+#endif
+
+/*
+** Hybrid distributed/shared-memory switch. It is set in the makefile
+** when compiling with both USE_MPI and USE_OpenMP. Each MPI process
+** owns a single tile and the OpenMP threads share the J-loops of the
+** most expensive vertical kernels.
+*/
+
+#if defined HYBRID_OMP && !defined DISTRIBUTE
+# undef HYBRID_OMP
+#endif
+
+/*
+** The fused 3D predictor pipeline steps through the rows of tiles in
+** sequence (or the J-strips of each node tile in distributed-memory),
+** so it is not available in shared-memory applications. It is not
+** available when other algorithms are processed between the pipelined
+** kernels.
+*/
+
+#if defined FUSED_KERNELS && \
+    (defined _OPENMP         || !defined SOLVE3D        || \
+     defined NESTING         || defined ADJUST_BOUNDARY  || \
+     defined ADJUST_STFLUX   || defined ADJUST_WSTRESS   || \
+     defined MCT_LIB         || \
+     defined NEARSHORE_MELLOR05 || defined NEARSHORE_MELLOR08)
+# undef FUSED_KERNELS
+#endif
+
+/*
+** The wide halo barotropic stepping extends the tile bounds of the
+** distributed-memory partition into the halo region, so it is not
+** available with shared-memory tiles, nesting, or wetting and drying
+** since the masks change between fast time-steps.  The 2D momentum
+** diagnostics arrays have no wide halo copies.
+*/
+
+#if defined WIDE_HALO_2D && \
+    (!defined DISTRIBUTE     || defined _OPENMP          || \
+     !defined SOLVE3D        || defined NESTING          || \
+     defined WET_DRY         || defined DIAGNOSTICS_UV)
+# undef WIDE_HALO_2D
+#endif
+
+/*
+** The compressed wet-points lists are built from the time-independent
+** Land/Sea mask, so they are not available with wetting and drying.
+*/
+
+#if defined WET_POINTS && \
+    (!defined MASKING || !defined SOLVE3D || defined WET_DRY)
+# undef WET_POINTS
+#endif
+
 /*
 ** Set tile range for distributed- or shared-memory configurations.
 */
@@ -442,6 +504,72 @@
 # define ANA_PERTURB
 #endif
 
+/*
+** The balanced tile partition is computed from the Land/Sea mask in the
+** grid NetCDF file.
+*/
+
+#if defined BALANCED_TILES && (!defined MASKING || defined ANA_MASK)
+# undef BALANCED_TILES
+#endif
+
+/*
+** Land tiles elimination is only available in MPI applications of the
+** nonlinear model that read the Land/Sea mask from the grid NetCDF
+** file. The dropped tiles do not have a process, so the collective
+** "mpi_allreduce" communications are used in "mp_assemble",
+** "mp_boundary", "mp_collect", and "mp_reduce".
+*/
+
+#if defined DROP_LAND_TILES && \
+    (!defined MPI     || !defined MASKING || defined ANA_MASK || \
+      defined ADJOINT || defined TANGENT  || defined PIO_LIB)
+# undef DROP_LAND_TILES
+#endif
+
+#ifdef DROP_LAND_TILES
+# undef ASSEMBLE_ALLGATHER
+# undef ASSEMBLE_SENDRECV
+# define ASSEMBLE_ALLREDUCE
+# undef BOUNDARY_ALLGATHER
+# define BOUNDARY_ALLREDUCE
+# undef COLLECT_ALLGATHER
+# undef COLLECT_SENDRECV
+# define COLLECT_ALLREDUCE
+# undef REDUCE_ALLGATHER
+# undef REDUCE_SENDRECV
+# define REDUCE_ALLREDUCE
+#endif
+
+/*
+** Mixed precision stores the tracers and vertical mixing coefficients
+** in 32-bit.  It is only available in the nonlinear model of single
+** grid applications with the standard NetCDF library.  The offline
+** floats load the archived tracers and vertical diffusion into double
+** precision "set_3dfld" and "vwalk_floats" arguments, so it is not
+** available with OFFLINE_FLOATS either.
+*/
+
+#if defined MIXED_PRECISION && \
+    (defined SINGLE_PRECISION || defined ADJOINT  || \
+     defined TANGENT          || defined NESTING  || \
+     defined PIO_LIB          || defined OFFLINE_FLOATS || \
+     !defined SOLVE3D)
+# undef MIXED_PRECISION
+#endif
+
+/*
+** I-loop of the column physics kernels over the RHO-points of tile row
+** "j".  With WET_POINTS, only the wet points are visited: their packed
+** I-indices, from "Istr" to "IendW", are in "IwetR" (see "set_masks").
+*/
+
+#ifdef WET_POINTS
+# define DO_WET_I(j) DO iw=Istr,IendW; i=IwetR(iw,j)
+#else
+# define DO_WET_I(j) DO i=Istr,Iend
+#endif
+
 /*
 ** Turn off nonlinear model switch.
 */
@@ -677,6 +805,23 @@
 # define FORWARD_READ
 #endif
 
+/*
+** Offline floats tracking is only available in the nonlinear 3D model
+** without nesting. The archived ocean state is read from the forward
+** NetCDF file (FWDNAME) so the reading of the basic state is activated.
+*/
+
+#if defined OFFLINE_FLOATS && \
+    (!defined FLOATS   || !defined NONLINEAR || !defined SOLVE3D || \
+      defined NESTING  ||  defined FOUR_DVAR || defined PROPAGATOR || \
+      defined TANGENT  ||  defined ADJOINT   || defined JEDI)
+# undef OFFLINE_FLOATS
+#endif
+
+#if defined OFFLINE_FLOATS && !defined FORWARD_READ
+# define FORWARD_READ
+#endif
+
 #if !defined FORWARD_WRITE          && \
     (defined ARRAY_MODES            || \
      defined CLIPPING               || \
@@ -807,6 +952,68 @@
 # define FLOAT_BIOLOGY
 #endif
 
+/*
+** Floats migration between adjacent tiles is only needed in
+** distributed-memory applications.
+*/
+
+#if defined FLOAT_MIGRATION && (!defined FLOATS || !defined DISTRIBUTE)
+# undef FLOAT_MIGRATION
+#endif
+
+/*
+** The point-to-point exchange of the nesting contact points is only
+** needed in distributed-memory applications.
+*/
+
+#if defined CONTACT_SENDRECV && (!defined NESTING || !defined DISTRIBUTE)
+# undef CONTACT_SENDRECV
+#endif
+
+/*
+** The concurrent time-stepping of the nested grids in a layer on
+** disjoint sets of processes is only available in the distributed-
+** memory nonlinear 3D kernel. The contact points, timers, and memory
+** reports are collected over all the processes, which do not match
+** the tile partition of any grid, so the collective "mpi_allreduce"
+** communications are used in "mp_assemble", "mp_collect", and
+** "mp_reduce".
+*/
+
+#if defined CONCURRENT_NESTING && \
+    (!defined NESTING        || !defined DISTRIBUTE      || \
+     !defined SOLVE3D        || defined ADJOINT          || \
+     defined TANGENT         || defined FOUR_DVAR        || \
+     defined VERIFICATION    || defined DISJOINTED       || \
+     defined CONTACT_SENDRECV || defined DROP_LAND_TILES || \
+     defined OFFLINE_FLOATS  || defined PARALLEL_IO      || \
+     defined PIO_LIB         || defined MODEL_COUPLING)
+# undef CONCURRENT_NESTING
+#endif
+
+#ifdef CONCURRENT_NESTING
+# undef ASSEMBLE_ALLGATHER
+# undef ASSEMBLE_SENDRECV
+# define ASSEMBLE_ALLREDUCE
+# undef COLLECT_ALLGATHER
+# undef COLLECT_SENDRECV
+# define COLLECT_ALLREDUCE
+# undef REDUCE_ALLGATHER
+# undef REDUCE_SENDRECV
+# define REDUCE_ALLREDUCE
+#endif
+
+/*
+** Gathering the station data in the writer node only is available in
+** distributed-memory applications.  All the nodes write with parallel
+** I/O, so it needs the collected data everywhere.
+*/
+
+#if defined STATIONS_GATHER && \
+    (!defined STATIONS || !defined DISTRIBUTE || defined PARALLEL_IO)
+# undef STATIONS_GATHER
+#endif
+
 /*
 ** Define internal option to couple to other models.
 **
@@ -94,6 +94,10 @@
       CALL ecosim_tile (ng, tile,                                       &
      &                  LBi, UBi, LBj, UBj, N(ng), NT(ng),              &
      &                  IminS, ImaxS, JminS, JmaxS,                     &
+#ifdef WET_POINTS
+     &                  GRID(ng) % IwetR,                               &
+     &                  GRID(ng) % NwetR,                               &
+#endif
      &                  nstp(ng), nnew(ng),                             &
 #ifdef MASKING
      &                  GRID(ng) % rmask,                               &
@@ -122,6 +126,9 @@
       SUBROUTINE ecosim_tile (ng, tile,                                 &
      &                        LBi, UBi, LBj, UBj, UBk, UBt,             &
      &                        IminS, ImaxS, JminS, JmaxS,               &
+#ifdef WET_POINTS
+     &                        IwetR, NwetR,                             &
+#endif
      &                        nstp, nnew,                               &
 #ifdef MASKING
      &                        rmask,                                    &
@@ -152,6 +159,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 #  if defined WET_DRY && defined DIAGNOSTICS_BIO
@@ -167,8 +178,12 @@
       real(r8), intent(inout) :: DiaBio3d(LBi:,LBj:,:,:)
       real(r8), intent(inout) :: DiaBio4d(LBi:,LBj:,:,:,:)
 # endif
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 #  if defined WET_DRY && defined DIAGNOSTICS_BIO
@@ -186,11 +201,14 @@
       real(r8), intent(inout) :: DiaBio4d(LBi:UBi,LBj:UBj,N(ng),        &
      &                                    NDbands,NDbio4d)
 # endif
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer, parameter :: Msink = 30
 
       integer :: i, j, k, ks
@@ -410,18 +428,21 @@
 !-----------------------------------------------------------------------
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
         DO k=1,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv2(i,k)=1.0_r8/(Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
         DO k=2,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv3(i,k)=1.0_r8/(Hz(i,j,k-1)+Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
@@ -439,7 +460,7 @@
         DO ibio=1,NBT
           itrc=idbio(ibio)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,itrc)=MAX(MinVal,t(i,j,k,nstp,itrc))
               Bio_old(i,k,itrc)=Bio(i,k,itrc)
 !!
@@ -458,7 +479,7 @@
 !  Extract potential temperature and salinity.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio(i,k,itemp)=t(i,j,k,nstp,itemp)
             Bio(i,k,isalt)=t(i,j,k,nstp,isalt)
           END DO
@@ -472,7 +493,7 @@
 !
         DO iphy=1,Nphy
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               refuge(i,k,iphy)=MinRefuge(iphy,ng)
             END DO
           END DO
@@ -485,7 +506,7 @@
         IF (Regen_flag(ng)) THEN
           DO ifec=1,Nfec
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FV1=EXP(RegTfac(ifec,ng)*(Bio(i,k,itemp)-               &
      &                  RegTbase(ifec,ng)))
                 Regen_C(i,k,ifec)=RegCR(ifec,ng)*FV1
@@ -502,7 +523,7 @@
 !
         DO iphy=1,Nphy
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               GtALG(i,k,iphy)=GtALG_max(iphy,ng)*                       &
      &                        EXP(PhyTfac(iphy,ng)*                     &
      &                            (Bio(i,k,itemp)-PhyTbase(iphy,ng)))
@@ -541,7 +562,7 @@
 !
         DO ibac=1,Nbac
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               GtBAC(i,k,ibac)=GtBAC_max(ibac,ng)*                       &
      &                        EXP(BacTfac(ibac,ng)*                     &
      &                            (Bio(i,k,itemp)-BacTbase(ibac,ng)))
@@ -558,7 +579,7 @@
 !
         DO iphy=1,Nphy
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FV1=MAX(1.0_r8,(Bio(i,k,iPhyC(iphy))/refuge(i,k,iphy)))
               graz_act(i,k,iphy)=HsGRZ(iphy,ng)*LOG(FV1)
             END DO
@@ -572,7 +593,7 @@
         ITER_LOOP : DO Iter=1,BioIter(ng)
 
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               totNH4_d(i,k)=0.0_r8
               totNO3_d(i,k)=0.0_r8
               totPO4_d(i,k)=0.0_r8
@@ -585,7 +606,7 @@
           END DO
           DO iphy=1,Nphy
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 NupNH4(i,k,iphy)=0.0_r8
                 NupNO3(i,k,iphy)=0.0_r8
                 NupPO4(i,k,iphy)=0.0_r8
@@ -602,7 +623,7 @@
 !
           DO iphy=1,Nphy
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 C2nALG(i,k,iphy)=0.0_r8
                 IF (Bio(i,k,iPhyN(iphy)).gt.0.0_r8) THEN
                   C2nALG(i,k,iphy)=Bio(i,k,iPhyC(iphy))/                &
@@ -635,7 +656,7 @@
 !
 ! Initialize.
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Ed_nz(i,N(ng))=0.0_r8
             E0_nz(i,N(ng))=0.0_r8
             Keuphotic(i)=N(ng)+1
@@ -937,7 +958,7 @@
 !
           DO ibac=1,Nbac
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
 !
 !  DOM uptake.
 !
@@ -998,7 +1019,7 @@
 !
           DO iphy=1,Nphy
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 IF (C2nALG(i,k,iphy).gt.C2nALGminABS(iphy,ng)) THEN
 !
 !  NOTE: these are being saved to test for total nutrient uptake.
@@ -1126,7 +1147,7 @@
 !  inhibits nitrification).
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               NitrBAC(i,k)=0.0_r8
               NH4toNO3(i,k)=0.0_r8
               NtoNBAC(i,k)=0.0_r8
@@ -1158,7 +1179,7 @@
 !-----------------------------------------------------------------------
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FV2=totNO3_d(i,k)*dtbio
               IF (FV2.gt.Bio(i,k,iNO3_)) THEN
                 FV1=(Bio(i,k,iNO3_)-VSMALL)/FV2
@@ -1274,7 +1295,7 @@
 !
           DO iphy=1,Nphy
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio_new(i,k,iPhyN(iphy))=Bio_new(i,k,iPhyN(iphy))+      &
      &                                   NupNO3(i,k,iphy)+              &
      &                                   NupNH4(i,k,iphy)+              &
@@ -1313,7 +1334,7 @@
 !  Nitrification fixes DIC into DOC.
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_new(i,k,iDIC_)=Bio_new(i,k,iDIC_)-                    &
      &                           NitrBAC(i,k)
             END DO
@@ -1324,7 +1345,7 @@
 !
           DO ibac=1,Nbac
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio_new(i,k,iBacC(ibac))=Bio_new(i,k,iBacC(ibac))+      &
      &                                   NitrBAC(i,k)
                 Bio_new(i,k,iBacN(ibac))=Bio_new(i,k,iBacN(ibac))+      &
@@ -1340,7 +1361,7 @@
 !  Update nutrient arrays for nitrification.
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_new(i,k,iNO3_)=Bio_new(i,k,iNO3_)+                    &
      &                           NH4toNO3(i,k)
               Bio_new(i,k,iNH4_)=Bio_new(i,k,iNH4_)-                    &
@@ -1356,7 +1377,7 @@
 !  Light mediated carbon growth.
 !-----------------------------------------------------------------------
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
             DO k=N(ng),Keuphotic(i),-1
               DO iphy=1,Nphy
                 IF (Bio(i,k,iPhyC(iphy)).gt.0.0_r8) THEN
@@ -1503,7 +1524,7 @@
 !-----------------------------------------------------------------------
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Het_BAC=0.0_r8
               RelDOC1=0.0_r8
               RelDON1=0.0_r8
@@ -1781,7 +1802,7 @@
 !
           DO iphy=1,Nphy
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
 !
 !  Excretion.
 !
@@ -1905,7 +1926,7 @@
               IF (iPigs(iphy,ipig).gt.0) THEN
                 itrc=iPigs(iphy,ipig)
                 DO k=1,N(ng)
-                  DO i=Istr,Iend
+                  DO_WET_I(j)
                     IF (Bio(i,k,iPhyC(iphy)).gt.refuge(i,k,iphy)) THEN
                       FV1=graz_act(i,k,iphy)*Bio(i,k,itrc)
                       Bio_new(i,k,itrc)=Bio_new(i,k,itrc) - FV1
@@ -1924,7 +1945,7 @@
 !
           DO ibac=1,Nbac
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
 !
 !  Grazing calculation. (All fecal material to slow sinking pool.)
 !
@@ -2021,7 +2042,7 @@
 !
           DO ifec=1,Nfec
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
 !
 !  Carbon calculations.  All carbon goes to CO2.
 !
@@ -2071,7 +2092,7 @@
 !-----------------------------------------------------------------------
 !
           IF (RtUVR_flag(ng)) THEN
-            DO i=Istr,Iend
+            DO_WET_I(j)
 !
 !  If Ed_nz(i,N(ng)) > zero, then there is sunlight. Standardizing rate
 !  to 1500 umol quanta m-2 s-1.
@@ -2145,7 +2166,7 @@
 !  Create optimal pigment ratios.
 !-----------------------------------------------------------------------
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
             IF (Keuphotic(i).le.N(ng)) THEN
               DO iphy=1,Nphy
 !
@@ -2300,18 +2321,18 @@
 !  constituent concentration.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 qc(i,k)=Bio(i,k,itrc)
               END DO
             END DO
 !
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(qc(i,k+1)-qc(i,k))*Hz_inv2(i,k)
               END DO
             END DO
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=Hz(i,j,k)*FC(i,k)
                 dltL=Hz(i,j,k)*FC(i,k-1)
                 cff=Hz(i,j,k-1)+2.0_r8*Hz(i,j,k)+Hz(i,j,k+1)
@@ -2350,14 +2371,14 @@
             END DO
             cff=1.0E-14_r8
             DO k=2,N(ng)-2
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltL=MAX(cff,WL(i,k  ))
                 dltR=MAX(cff,WR(i,k+1))
                 bR(i,k)=(dltR*bR(i,k)+dltL*bL(i,k+1))/(dltR+dltL)
                 bL(i,k+1)=bR(i,k)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,N(ng))=0.0_r8            ! NO-flux boundary condition
 #if defined LINEAR_CONTINUATION
               bL(i,N(ng))=bR(i,N(ng)-1)
@@ -2388,7 +2409,7 @@
 !  inside the grid box.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=bR(i,k)-qc(i,k)
                 dltL=qc(i,k)-bL(i,k)
                 cffR=2.0_r8*dltR
@@ -2422,7 +2443,7 @@
 !
             cff=dtbio*ABS(Wbio(isink))
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k-1)=0.0_r8
                 WL(i,k)=z_w(i,j,k-1)+cff
                 WR(i,k)=Hz(i,j,k)*qc(i,k)
@@ -2431,7 +2452,7 @@
             END DO
             DO k=1,N(ng)
               DO ks=k,N(ng)-1
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   IF (WL(i,k).gt.z_w(i,j,ks)) THEN
                     ksource(i,k)=ks+1
                     FC(i,k-1)=FC(i,k-1)+WR(i,ks)
@@ -2443,7 +2464,7 @@
 !  Finalize computation of flux: add fractional part.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 ks=ksource(i,k)
                 cu=MIN(1.0_r8,(WL(i,k)-z_w(i,j,ks-1))*Hz_inv(i,ks))
                 FC(i,k-1)=FC(i,k-1)+                                    &
@@ -2456,7 +2477,7 @@
               END DO
             END DO
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio(i,k,itrc)=qc(i,k)+(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
               END DO
             END DO
@@ -2472,27 +2493,27 @@
 !
             DO ifec=1,Nfec
               IF (itrc.eq.iFecN(ifec)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iNO3_)=Bio(i,1,iNO3_)+cff1
                 END DO
               ELSE IF (itrc.eq.iFecC(ifec)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iDIC_)=Bio(i,1,iDIC_)+cff1
                 END DO
               ELSE IF (itrc.eq.iFecP(ifec)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iPO4_)=Bio(i,1,iPO4_)+cff1
                 END DO
               ELSE IF (itrc.eq.iFecS(ifec)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iSiO_)=Bio(i,1,iSiO_)+cff1
                 END DO
               ELSE IF (itrc.eq.iFecF(ifec)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iFeO_)=Bio(i,1,iFeO_)+cff1
                 END DO
@@ -2500,27 +2521,27 @@
             END DO
             DO iphy=1,Nphy
               IF (itrc.eq.iPhyN(iphy)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iNO3_)=Bio(i,1,iNO3_)+cff1
                 END DO
               ELSE IF (itrc.eq.iPhyC(iphy)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iDIC_)=Bio(i,1,iDIC_)+cff1
                 END DO
               ELSE IF (itrc.eq.iPhyP(iphy)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iPO4_)=Bio(i,1,iPO4_)+cff1
                 END DO
               ELSE IF (itrc.eq.iPhyS(iphy)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iSiO_)=Bio(i,1,iSiO_)+cff1
                 END DO
               ELSE IF (itrc.eq.iPhyF(iphy)) THEN
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   cff1=FC(i,0)*Hz_inv(i,1)
                   Bio(i,1,iFeO_)=Bio(i,1,iFeO_)+cff1
                 END DO
@@ -2536,7 +2557,7 @@
           DO ibio=1,NBT
             itrc=idbio(ibio)
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                   Bio(i,k,itrc)=Bio(i,k,itrc)+dtbio*Bio_new(i,k,itrc)
               END DO
             END DO
@@ -2562,7 +2583,7 @@
         DO ibio=1,NBT
           itrc=idbio(ibio)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
                cff=Bio(i,k,itrc)-Bio_old(i,k,itrc)
                t(i,j,k,nnew,itrc)=t(i,j,k,nnew,itrc)+cff*Hz(i,j,k)
             END DO
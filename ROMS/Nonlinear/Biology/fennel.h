@@ -171,6 +171,10 @@
       CALL fennel_tile (ng, tile,                                       &
      &                  LBi, UBi, LBj, UBj, N(ng), NT(ng),              &
      &                  IminS, ImaxS, JminS, JmaxS,                     &
+#ifdef WET_POINTS
+     &                  GRID(ng) % IwetR,                               &
+     &                  GRID(ng) % NwetR,                               &
+#endif
      &                  nstp(ng), nnew(ng),                             &
 #ifdef MASKING
      &                  GRID(ng) % rmask,                               &
@@ -214,6 +218,9 @@
       SUBROUTINE fennel_tile (ng, tile,                                 &
      &                        LBi, UBi, LBj, UBj, UBk, UBt,             &
      &                        IminS, ImaxS, JminS, JmaxS,               &
+#ifdef WET_POINTS
+     &                        IwetR, NwetR,                             &
+#endif
      &                        nstp, nnew,                               &
 #ifdef MASKING
      &                        rmask,                                    &
@@ -256,6 +263,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 #  ifdef WET_DRY
@@ -285,8 +296,12 @@
       real(r8), intent(inout) :: DiaBio2d(LBi:,LBj:,:)
       real(r8), intent(inout) :: DiaBio3d(LBi:,LBj:,:,:)
 # endif
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 #  ifdef WET_DRY
@@ -316,11 +331,14 @@
       real(r8), intent(inout) :: DiaBio2d(LBi:UBi,LBj:UBj,NDbio2d)
       real(r8), intent(inout) :: DiaBio3d(LBi:UBi,LBj:UBj,UBk,NDbio3d)
 # endif
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
 #ifdef CARBON
       integer, parameter :: Nsink = 6
 #else
@@ -566,18 +584,21 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
         DO k=1,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv2(i,k)=1.0_r8/(Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
         DO k=2,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv3(i,k)=1.0_r8/(Hz(i,j,k-1)+Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
@@ -592,7 +613,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_old(i,k,ibio)=MAX(0.0_r8,t(i,j,k,nstp,ibio))
               Bio(i,k,ibio)=Bio_old(i,k,ibio)
             END DO
@@ -600,7 +621,7 @@
         END DO
 #ifdef CARBON
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio_old(i,k,iTIC_)=MIN(Bio_old(i,k,iTIC_),3000.0_r8)
             Bio_old(i,k,iTIC_)=MAX(Bio_old(i,k,iTIC_),400.0_r8)
             Bio(i,k,iTIC_)=Bio_old(i,k,iTIC_)
@@ -611,7 +632,7 @@
 !  Extract potential temperature and salinity.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio(i,k,itemp)=MIN(t(i,j,k,nstp,itemp),35.0_r8)
             Bio(i,k,isalt)=MAX(t(i,j,k,nstp,isalt), 0.0_r8)
           END DO
@@ -621,7 +642,7 @@
 !  net shortwave radiation is scaled back to Watts/m2 and multiplied by
 !  the fraction that is photosynthetically available, PARfrac.
 !
-        DO i=Istr,Iend
+        DO_WET_I(j)
           PARsur(i)=PARfrac(ng)*srflx(i,j)*rho0*Cp
         END DO
 !
@@ -697,7 +718,7 @@
 !  by it twice: once to get it in the middle of grid-box and once the
 !  compute on the lower grid-box interface.
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
             PAR=PARsur(i)
             AttFac=0.0_r8
             IF (PARsur(i).gt.0.0_r8) THEN
@@ -891,7 +912,7 @@
           fac1=dtdays*ZooGR(ng)
           cff2=dtdays*PhyMR(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
 !
 ! Phytoplankton grazing by zooplankton.
 !
@@ -937,7 +958,7 @@
           fac2=dtdays*ZooMR(ng)
           fac3=dtdays*ZooER(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               fac1=fac3*Bio(i,k,iPhyt)*Bio(i,k,iPhyt)/                  &
      &             (K_Phy(ng)+Bio(i,k,iPhyt)*Bio(i,k,iPhyt))
               cff2=fac2*Bio(i,k,iZoop)
@@ -986,7 +1007,7 @@
 !
           fac1=dtdays*CoagR(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff1=fac1*(Bio(i,k,iSDeN)+Bio(i,k,iPhyt))
               cff2=1.0_r8/(1.0_r8+cff1)
               Bio(i,k,iPhyt)=Bio(i,k,iPhyt)*cff2
@@ -1010,7 +1031,7 @@
 !
 #ifdef OXYGEN
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               fac1=MAX(Bio(i,k,iOxyg)-6.0_r8,0.0_r8) ! O2 off max
               fac2=MAX(fac1/(3.0_r8+fac1),0.0_r8) ! MM for O2 dependence
               cff1=dtdays*SDeRRN(ng)*fac2
@@ -1061,7 +1082,7 @@
           cff8=1.0_r8/(1.0_r8+cff7)
 # endif
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iSDeN)=Bio(i,k,iSDeN)*cff2
               Bio(i,k,iLDeN)=Bio(i,k,iLDeN)*cff4
               N_Flux_RemineS=Bio(i,k,iSDeN)*cff1
@@ -1106,7 +1127,7 @@
           cff2=dtdays*0.31_r8*24.0_r8/100.0_r8
 # endif
           k=N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
 !
 !  Compute O2 transfer velocity : u10squared (u10 in m/s)
 !
@@ -1165,7 +1186,7 @@
           cff8=1.0_r8/(1.0_r8+cff7)
 # endif
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iSDeC)=Bio(i,k,iSDeC)*cff2
               Bio(i,k,iLDeC)=Bio(i,k,iLDeC)*cff4
               C_Flux_RemineS=Bio(i,k,iSDeC)*cff1
@@ -1185,7 +1206,7 @@
 !  following Brewer et al. (1986).
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iTAlk)=587.05_r8+50.56_r8*Bio(i,k,isalt)
             END DO
           END DO
@@ -1227,7 +1248,7 @@
 # else
           cff2=dtdays*0.31_r8*24.0_r8/100.0_r8
 # endif
-          DO i=Istr,Iend
+          DO_WET_I(j)
 !
 !  Compute CO2 transfer velocity : u10squared (u10 in m/s)
 !
@@ -1300,18 +1321,18 @@
 !  constituent concentration.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 qc(i,k)=Bio(i,k,ibio)
               END DO
             END DO
 !
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(qc(i,k+1)-qc(i,k))*Hz_inv2(i,k)
               END DO
             END DO
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=Hz(i,j,k)*FC(i,k)
                 dltL=Hz(i,j,k)*FC(i,k-1)
                 cff=Hz(i,j,k-1)+2.0_r8*Hz(i,j,k)+Hz(i,j,k+1)
@@ -1350,14 +1371,14 @@
             END DO
             cff=1.0E-14_r8
             DO k=2,N(ng)-2
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltL=MAX(cff,WL(i,k  ))
                 dltR=MAX(cff,WR(i,k+1))
                 bR(i,k)=(dltR*bR(i,k)+dltL*bL(i,k+1))/(dltR+dltL)
                 bL(i,k+1)=bR(i,k)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,N(ng))=0.0_r8            ! NO-flux boundary condition
 #if defined LINEAR_CONTINUATION
               bL(i,N(ng))=bR(i,N(ng)-1)
@@ -1388,7 +1409,7 @@
 !  inside the grid box.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=bR(i,k)-qc(i,k)
                 dltL=qc(i,k)-bL(i,k)
                 cffR=2.0_r8*dltR
@@ -1422,7 +1443,7 @@
 !
             cff=dtdays*ABS(Wbio(isink))
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k-1)=0.0_r8
                 WL(i,k)=z_w(i,j,k-1)+cff
                 WR(i,k)=Hz(i,j,k)*qc(i,k)
@@ -1431,7 +1452,7 @@
             END DO
             DO k=1,N(ng)
               DO ks=k,N(ng)-1
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   IF (WL(i,k).gt.z_w(i,j,ks)) THEN
                     ksource(i,k)=ks+1
                     FC(i,k-1)=FC(i,k-1)+WR(i,ks)
@@ -1443,7 +1464,7 @@
 !  Finalize computation of flux: add fractional part.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 ks=ksource(i,k)
                 cu=MIN(1.0_r8,(WL(i,k)-z_w(i,j,ks-1))*Hz_inv(i,ks))
                 FC(i,k-1)=FC(i,k-1)+                                    &
@@ -1456,7 +1477,7 @@
               END DO
             END DO
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio(i,k,ibio)=qc(i,k)+(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
               END DO
             END DO
@@ -1478,7 +1499,7 @@
             IF ((ibio.eq.iPhyt).or.                                     &
      &          (ibio.eq.iSDeN).or.                                     &
      &          (ibio.eq.iLDeN)) THEN
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 cff1=FC(i,0)*Hz_inv(i,1)
 # ifdef DENITRIFICATION
                 Bio(i,1,iNH4_)=Bio(i,1,iNH4_)+cff1*cff2
@@ -1516,13 +1537,13 @@
 #  endif
             IF ((ibio.eq.iSDeC).or.                                     &
      &          (ibio.eq.iLDeC))THEN
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 cff1=FC(i,0)*Hz_inv(i,1)
                 Bio(i,1,iTIC_)=Bio(i,1,iTIC_)+cff1
               END DO
             END IF
             IF (ibio.eq.iPhyt)THEN
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 cff1=FC(i,0)*Hz_inv(i,1)
                 Bio(i,1,iTIC_)=Bio(i,1,iTIC_)+cff1*PhyCN(ng)
               END DO
@@ -1550,7 +1571,7 @@
 !
 #ifdef CARBON
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio(i,k,iTIC_)=MIN(Bio(i,k,iTIC_),3000.0_r8)
             Bio(i,k,iTIC_)=MAX(Bio(i,k,iTIC_),400.0_r8)
           END DO
@@ -1559,7 +1580,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
 #ifdef MASKING
               cff=cff*rmask(i,j)
@@ -90,6 +90,10 @@
       CALL hypoxia_srm_tile (ng, tile,                                  &
      &                       LBi, UBi, LBj, UBj, N(ng), NT(ng),         &
      &                       IminS, ImaxS, JminS, JmaxS,                &
+#ifdef WET_POINTS
+     &                       GRID(ng) % IwetR,                          &
+     &                       GRID(ng) % NwetR,                          &
+#endif
      &                       nstp(ng), nnew(ng),                        &
 #ifdef MASKING
      &                       GRID(ng) % rmask,                          &
@@ -122,6 +126,9 @@
       SUBROUTINE hypoxia_srm_tile (ng, tile,                            &
      &                             LBi, UBi, LBj, UBj, UBk, UBt,        &
      &                             IminS, ImaxS, JminS, JmaxS,          &
+#ifdef WET_POINTS
+     &                             IwetR, NwetR,                        &
+#endif
      &                             nstp, nnew,                          &
 #ifdef MASKING
      &                             rmask,                               &
@@ -155,6 +162,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 #  if defined WET_DRY && defined DIAGNOSTICS_BIO
@@ -173,8 +184,12 @@
 # ifdef DIAGNOSTICS_BIO
       real(r8), intent(inout) :: DiaBio2d(LBi:,LBj:,:)
 # endif
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 #  if defined WET_DRY && defined DIAGNOSTICS_BIO
@@ -193,11 +208,14 @@
 # ifdef DIAGNOSTICS_BIO
       real(r8), intent(inout) :: DiaBio2d(LBi:UBi,LBj:UBj,NDbio2d)
 # endif
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer :: Iter, i, ibio, itrc, j, k
 
       real(r8) :: u10squ
@@ -278,8 +296,11 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
@@ -294,7 +315,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_old(i,k,ibio)=MAX(0.0_r8,t(i,j,k,nstp,ibio))
               Bio(i,k,ibio)=Bio_old(i,k,ibio)
             END DO
@@ -304,7 +325,7 @@
 !  Extract potential temperature and salinity.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio(i,k,itemp)=MIN(t(i,j,k,nstp,itemp),35.0_r8)
             Bio(i,k,isalt)=MAX(t(i,j,k,nstp,isalt), 0.0_r8)
           END DO
@@ -332,7 +353,7 @@
 !  It is assumed that has zero values in places with no respiration.
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff1=dtdays*respiration(i,j,k)
               Bio(i,k,iOxyg)=Bio(i,k,iOxyg)-cff1
               Bio(i,k,iOxyg)=MAX(Bio(i,k,iOxyg),0.0_r8)
@@ -349,7 +370,7 @@
 !  L and O (1992) formula, (EXP(AA) is in ml/l).
 !
           k=N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             TS=LOG((298.15_r8-Bio(i,k,itemp))/                          &
      &             (273.15_r8+Bio(i,k,itemp)))
             AA=OA0+TS*(OA1+TS*(OA2+TS*(OA3+TS*(OA4+TS*OA5))))+          &
@@ -369,7 +390,7 @@
           cff2=rho0*550.0_r8
           cff3=dtdays*0.31_r8*24.0_r8/100.0_r8
           k=N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
 !
 !  Compute O2 transfer velocity : u10squared (u10 in m/s)
 !
@@ -451,7 +472,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
               t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff*Hz(i,j,k)
             END DO
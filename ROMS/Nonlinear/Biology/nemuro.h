@@ -79,6 +79,10 @@
       CALL nemuro_tile (ng, tile,                                       &
      &                  LBi, UBi, LBj, UBj, N(ng), NT(ng),              &
      &                  IminS, ImaxS, JminS, JmaxS,                     &
+#ifdef WET_POINTS
+     &                  GRID(ng) % IwetR,                               &
+     &                  GRID(ng) % NwetR,                               &
+#endif
      &                  nstp(ng), nnew(ng),                             &
 #ifdef MASKING
      &                  GRID(ng) % rmask,                               &
@@ -100,6 +104,9 @@
       SUBROUTINE nemuro_tile (ng, tile,                                 &
      &                        LBi, UBi, LBj, UBj, UBk, UBt,             &
      &                        IminS, ImaxS, JminS, JmaxS,               &
+#ifdef WET_POINTS
+     &                        IwetR, NwetR,                             &
+#endif
      &                        nstp, nnew,                               &
 #ifdef MASKING
      &                        rmask,                                    &
@@ -122,6 +129,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 # endif
@@ -129,8 +140,12 @@
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
       real(r8), intent(in) :: z_w(LBi:,LBj:,0:)
       real(r8), intent(in) :: srflx(LBi:,LBj:)
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 # endif
@@ -138,11 +153,14 @@
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,UBk)
       real(r8), intent(in) :: z_w(LBi:UBi,LBj:UBj,0:UBk)
       real(r8), intent(in) :: srflx(LBi:UBi,LBj:UBj)
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer, parameter :: Nsink = 2
 
       integer :: Iter, ibio, indx, isink, itime, itrc, iTrcMax
@@ -218,18 +236,21 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
         DO k=1,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv2(i,k)=1.0_r8/(Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
         DO k=2,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv3(i,k)=1.0_r8/(Hz(i,j,k-1)+Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
@@ -244,7 +265,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_old(i,k,ibio)=MAX(0.0_r8,t(i,j,k,nstp,ibio))
               Bio(i,k,ibio)=Bio_old(i,k,ibio)
             END DO
@@ -254,7 +275,7 @@
 !  Extract potential temperature and salinity.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio(i,k,itemp)=t(i,j,k,nstp,itemp)
           END DO
         END DO
@@ -263,7 +284,7 @@
 !  net shortwave radiation is scaled back to Watts/m2 and multiplied by
 !  the fraction that is photosynthetically available, PARfrac.
 !
-        DO i=Istr,Iend
+        DO_WET_I(j)
           PARsur(i)=PARfrac(ng)*srflx(i,j)*rho0*Cp
         END DO
 !
@@ -327,7 +348,7 @@
 !
           cff1=1.0/VmaxS(ng)
           cff2=1.0/VmaxL(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             AttS=PARsur(i)
             AttL=PARsur(i)
             IF (PARsur(i).gt.0.0_r8) THEN              ! day time
@@ -378,7 +399,7 @@
 !
           cff=dtdays*VmaxS(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
 !
 !  Small Phytoplankton gross primary productivity, GppPS.
 !
@@ -425,7 +446,7 @@
           fac1=1.0/RSiN(ng)
           fac2=dtdays*ResPL0(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
 !
 !  Large Phytoplankton gross primary productivity, GppPL. Notice that
 !  the primary productivity is limited by previous time-step silicate
@@ -480,7 +501,7 @@
           fac1=dtdays*MorPS0(ng)
           fac2=dtdays*MorPL0(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff1=fac1*Bio(i,k,iSphy)*EXP(KMorPS(ng)*Bio(i,k,itemp))
               cff2=fac2*Bio(i,k,iLphy)*EXP(KMorPL(ng)*Bio(i,k,itemp))
               Bio(i,k,iSphy)=Bio(i,k,iSphy)/(1.0_r8+cff1)
@@ -557,7 +578,7 @@
           fac6=dtdays*GRmaxPzs(ng)
           fac7=dtdays*GRmaxPzl(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
 !
 !  Temperature-dependent term (Q10).
 !
@@ -756,7 +777,7 @@
           fac2=dtdays*MorZL0(ng)
           fac3=dtdays*MorZP0(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff1=fac1*Bio(i,k,iSzoo)*EXP(KMorZS(ng)*Bio(i,k,itemp))
               cff2=fac2*Bio(i,k,iLzoo)*EXP(KMorZL(ng)*Bio(i,k,itemp))
               cff3=fac3*Bio(i,k,iPzoo)*EXP(KMorZP(ng)*Bio(i,k,itemp))
@@ -780,7 +801,7 @@
           fac4=dtdays*VD2N0(ng)
           fac5=dtdays*VO2S0(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
 !
 !  Nitrification: NH4 to NO3.
 !
@@ -836,18 +857,18 @@
 !  constituent concentration.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 qc(i,k)=Bio(i,k,ibio)
               END DO
             END DO
 !
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(qc(i,k+1)-qc(i,k))*Hz_inv2(i,k)
               END DO
             END DO
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=Hz(i,j,k)*FC(i,k)
                 dltL=Hz(i,j,k)*FC(i,k-1)
                 cff=Hz(i,j,k-1)+2.0_r8*Hz(i,j,k)+Hz(i,j,k+1)
@@ -886,14 +907,14 @@
             END DO
             cff=1.0E-14_r8
             DO k=2,N(ng)-2
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltL=MAX(cff,WL(i,k  ))
                 dltR=MAX(cff,WR(i,k+1))
                 bR(i,k)=(dltR*bR(i,k)+dltL*bL(i,k+1))/(dltR+dltL)
                 bL(i,k+1)=bR(i,k)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,N(ng))=0.0_r8            ! NO-flux boundary condition
 #if defined LINEAR_CONTINUATION
               bL(i,N(ng))=bR(i,N(ng)-1)
@@ -924,7 +945,7 @@
 !  inside the grid box.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=bR(i,k)-qc(i,k)
                 dltL=qc(i,k)-bL(i,k)
                 cffR=2.0_r8*dltR
@@ -958,7 +979,7 @@
 !
             cff=dtdays*ABS(Wbio(isink))
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k-1)=0.0_r8
                 WL(i,k)=z_w(i,j,k-1)+cff
                 WR(i,k)=Hz(i,j,k)*qc(i,k)
@@ -967,7 +988,7 @@
             END DO
             DO k=1,N(ng)
               DO ks=k,N(ng)-1
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   IF (WL(i,k).gt.z_w(i,j,ks)) THEN
                     ksource(i,k)=ks+1
                     FC(i,k-1)=FC(i,k-1)+WR(i,ks)
@@ -979,7 +1000,7 @@
 !  Finalize computation of flux: add fractional part.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 ks=ksource(i,k)
                 cu=MIN(1.0_r8,(WL(i,k)-z_w(i,j,ks-1))*Hz_inv(i,ks))
                 FC(i,k-1)=FC(i,k-1)+                                    &
@@ -992,7 +1013,7 @@
               END DO
             END DO
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio(i,k,ibio)=qc(i,k)+(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
               END DO
             END DO
@@ -1011,12 +1032,12 @@
 !       the benthos to the water column?  NH4 to NO3?
 !
             IF (ibio.eq.iPON_) THEN
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 cff1=FC(i,0)*Hz_inv(i,1)
                 Bio(i,1,iNO3_)=Bio(i,1,iNO3_)+cff1
               END DO
             ELSE IF (ibio.eq.iopal) THEN
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 cff1=FC(i,0)*Hz_inv(i,1)
                 Bio(i,1,iSiOH)=Bio(i,1,iSiOH)+cff1
               END DO
@@ -1044,7 +1065,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
               t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff*Hz(i,j,k)
             END DO
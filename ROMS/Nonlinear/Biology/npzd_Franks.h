@@ -67,6 +67,10 @@
       CALL npzd_franks_tile (ng, tile,                                  &
      &                       LBi, UBi, LBj, UBj, N(ng), NT(ng),         &
      &                       IminS, ImaxS, JminS, JmaxS,                &
+#ifdef WET_POINTS
+     &                       GRID(ng) % IwetR,                          &
+     &                       GRID(ng) % NwetR,                          &
+#endif
      &                       nstp(ng), nnew(ng),                        &
 #ifdef MASKING
      &                       GRID(ng) % rmask,                          &
@@ -87,6 +91,9 @@
       SUBROUTINE npzd_franks_tile (ng, tile,                            &
      &                             LBi, UBi, LBj, UBj, UBk, UBt,        &
      &                             IminS, ImaxS, JminS, JmaxS,          &
+#ifdef WET_POINTS
+     &                             IwetR, NwetR,                        &
+#endif
      &                             nstp, nnew,                          &
 #ifdef MASKING
      &                             rmask,                               &
@@ -108,25 +115,36 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 # endif
       real(r8), intent(in) :: Hz(LBi:,LBj:,:)
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
       real(r8), intent(in) :: z_w(LBi:,LBj:,0:)
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 # endif
       real(r8), intent(in) :: Hz(LBi:UBi,LBj:UBj,UBk)
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,UBk)
       real(r8), intent(in) :: z_w(LBi:UBi,LBj:UBj,0:UBk)
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer, parameter :: Nsink = 1
 
       integer :: Iter, i, ibio, isink, itrc, itrmx, j, k, ks
@@ -183,18 +201,21 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
         DO k=1,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv2(i,k)=1.0_r8/(Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
         DO k=2,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv3(i,k)=1.0_r8/(Hz(i,j,k-1)+Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
@@ -209,7 +230,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_old(i,k,ibio)=t(i,j,k,nstp,ibio)
             END DO
           END DO
@@ -218,7 +239,7 @@
 !  Determine Correction for negativity.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             cff1=MAX(0.0_r8,eps-Bio_old(i,k,iNO3_))+                    &
      &           MAX(0.0_r8,eps-Bio_old(i,k,iPhyt))+                    &
      &           MAX(0.0_r8,eps-Bio_old(i,k,iZoop))+                    &
@@ -315,7 +336,7 @@
 !
           cff1=dtdays*Vm_NO3(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,iPhyt)*                                       &
      &            cff1*EXP(K_ext(ng)*z_r(i,j,k))/                       &
      &            (K_NO3(ng)+Bio(i,k,iNO3_))
@@ -333,7 +354,7 @@
           cff2=dtdays*PhyMR(ng)
           cff3=K_phy(ng)*K_phy(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,iZoop)*Bio(i,k,iPhyt)*cff1/                   &
      &            (cff3+Bio(i,k,iPhyt)*Bio(i,k,iPhyt))
               Bio(i,k,iPhyt)=Bio(i,k,iPhyt)/                            &
@@ -354,7 +375,7 @@
           cff2=dtdays*ZooMR(ng)
           cff3=dtdays*ZooMD(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iZoop)=Bio(i,k,iZoop)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iZoop)*cff2
@@ -368,7 +389,7 @@
           cff1=dtdays*DetRR(ng)
           cff2=1.0_r8/(1.0_r8+cff1)
            DO k=1,N(ng)
-             DO i=Istr,Iend
+             DO_WET_I(j)
                Bio(i,k,iSDet)=Bio(i,k,iSDet)*cff2
                Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                           &
      &                        Bio(i,k,iSDet)*cff1
@@ -392,18 +413,18 @@
 !  constituent concentration.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 qc(i,k)=Bio(i,k,ibio)
               END DO
             END DO
 !
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(qc(i,k+1)-qc(i,k))*Hz_inv2(i,k)
               END DO
             END DO
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=Hz(i,j,k)*FC(i,k)
                 dltL=Hz(i,j,k)*FC(i,k-1)
                 cff=Hz(i,j,k-1)+2.0_r8*Hz(i,j,k)+Hz(i,j,k+1)
@@ -442,14 +463,14 @@
             END DO
             cff=1.0E-14_r8
             DO k=2,N(ng)-2
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltL=MAX(cff,WL(i,k  ))
                 dltR=MAX(cff,WR(i,k+1))
                 bR(i,k)=(dltR*bR(i,k)+dltL*bL(i,k+1))/(dltR+dltL)
                 bL(i,k+1)=bR(i,k)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,N(ng))=0.0_r8            ! NO-flux boundary condition
 #if defined LINEAR_CONTINUATION
               bL(i,N(ng))=bR(i,N(ng)-1)
@@ -480,7 +501,7 @@
 !  inside the grid box.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=bR(i,k)-qc(i,k)
                 dltL=qc(i,k)-bL(i,k)
                 cffR=2.0_r8*dltR
@@ -514,7 +535,7 @@
 !
             cff=dtdays*ABS(Wbio(isink))
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k-1)=0.0_r8
                 WL(i,k)=z_w(i,j,k-1)+cff
                 WR(i,k)=Hz(i,j,k)*qc(i,k)
@@ -523,7 +544,7 @@
             END DO
             DO k=1,N(ng)
               DO ks=k,N(ng)-1
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   IF (WL(i,k).gt.z_w(i,j,ks)) THEN
                     ksource(i,k)=ks+1
                     FC(i,k-1)=FC(i,k-1)+WR(i,ks)
@@ -535,7 +556,7 @@
 !  Finalize computation of flux: add fractional part.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 ks=ksource(i,k)
                 cu=MIN(1.0_r8,(WL(i,k)-z_w(i,j,ks-1))*Hz_inv(i,ks))
                 FC(i,k-1)=FC(i,k-1)+                                    &
@@ -548,7 +569,7 @@
               END DO
             END DO
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio(i,k,ibio)=qc(i,k)+(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
               END DO
             END DO
@@ -574,7 +595,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
               t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff*Hz(i,j,k)
             END DO
@@ -70,6 +70,10 @@
       CALL npzd_powell_tile (ng, tile,                                  &
      &                       LBi, UBi, LBj, UBj, N(ng), NT(ng),         &
      &                       IminS, ImaxS, JminS, JmaxS,                &
+#ifdef WET_POINTS
+     &                       GRID(ng) % IwetR,                          &
+     &                       GRID(ng) % NwetR,                          &
+#endif
      &                       nstp(ng), nnew(ng),                        &
 #ifdef MASKING
      &                       GRID(ng) % rmask,                          &
@@ -91,6 +95,9 @@
       SUBROUTINE npzd_powell_tile (ng, tile,                            &
      &                             LBi, UBi, LBj, UBj, UBk, UBt,        &
      &                             IminS, ImaxS, JminS, JmaxS,          &
+#ifdef WET_POINTS
+     &                             IwetR, NwetR,                        &
+#endif
      &                             nstp, nnew,                          &
 #ifdef MASKING
      &                             rmask,                               &
@@ -113,6 +120,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 # endif
@@ -120,8 +131,12 @@
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
       real(r8), intent(in) :: z_w(LBi:,LBj:,0:)
       real(r8), intent(in) :: srflx(LBi:,LBj:)
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 # endif
@@ -129,11 +144,14 @@
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,UBk)
       real(r8), intent(in) :: z_w(LBi:UBi,LBj:UBj,0:UBk)
       real(r8), intent(in) :: srflx(LBi:UBi,LBj:UBj)
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer, parameter :: Nsink = 2
 
       integer :: Iter, i, ibio, isink, itime, itrc, iTrcMax, j, k, ks
@@ -197,18 +215,21 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
         DO k=1,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv2(i,k)=1.0_r8/(Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
         DO k=2,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv3(i,k)=1.0_r8/(Hz(i,j,k-1)+Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
@@ -219,7 +240,7 @@
 !  which is set to 1E-6 above.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
 !
 !  At input, all tracers (index nnew) from predictor step have
 !  transport units (m Tunits) since we do not have yet the new
@@ -265,7 +286,7 @@
 !  net shortwave radiation is scaled back to Watts/m2 and multiplied by
 !  the fraction that is photosynthetically available, PARfrac.
 !
-        DO i=Istr,Iend
+        DO_WET_I(j)
 #ifdef CONST_PAR
 !
 !  Specify constant surface irradiance a la Powell and Spitz.
@@ -334,7 +355,7 @@
 !
 !  Compute light attenuation as function of depth.
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
             PAR=PARsur(i)
             IF (PARsur(i).gt.0.0_r8) THEN              ! day time
               DO k=N(ng),1,-1
@@ -372,7 +393,7 @@
           cff2=Vm_NO3(ng)*Vm_NO3(ng)
           cff3=PhyIS(ng)*PhyIS(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff4=1.0_r8/SQRT(cff2+cff3*Light(i,k)*Light(i,k))
               cff=Bio(i,k,iPhyt)*                                       &
      &            cff1*cff4*Light(i,k)/                                 &
@@ -391,7 +412,7 @@
           cff1=dtdays*ZooGR(ng)
           cff2=1.0_r8-ZooEEN(ng)-ZooEED(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,iZoop)*                                       &
      &            cff1*(1.0_r8-EXP(-Ivlev(ng)*Bio(i,k,iPhyt)))/         &
      &            Bio(i,k,iPhyt)
@@ -412,7 +433,7 @@
           cff2=dtdays*PhyMRN(ng)
           cff1=1.0_r8/(1.0_r8+cff2+cff3)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iPhyt)=Bio(i,k,iPhyt)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iPhyt)*cff2
@@ -428,7 +449,7 @@
           cff2=dtdays*ZooMRN(ng)
           cff1=1.0_r8/(1.0_r8+cff2+cff3)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iZoop)=Bio(i,k,iZoop)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iZoop)*cff2
@@ -442,7 +463,7 @@
           cff2=dtdays*DetRR(ng)
           cff1=1.0_r8/(1.0_r8+cff2)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iSDet)=Bio(i,k,iSDet)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iSDet)*cff2
@@ -466,18 +487,18 @@
 !  constituent concentration.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 qc(i,k)=Bio(i,k,ibio)
               END DO
             END DO
 !
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(qc(i,k+1)-qc(i,k))*Hz_inv2(i,k)
               END DO
             END DO
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=Hz(i,j,k)*FC(i,k)
                 dltL=Hz(i,j,k)*FC(i,k-1)
                 cff=Hz(i,j,k-1)+2.0_r8*Hz(i,j,k)+Hz(i,j,k+1)
@@ -516,14 +537,14 @@
             END DO
             cff=1.0E-14_r8
             DO k=2,N(ng)-2
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltL=MAX(cff,WL(i,k  ))
                 dltR=MAX(cff,WR(i,k+1))
                 bR(i,k)=(dltR*bR(i,k)+dltL*bL(i,k+1))/(dltR+dltL)
                 bL(i,k+1)=bR(i,k)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,N(ng))=0.0_r8            ! NO-flux boundary condition
 #if defined LINEAR_CONTINUATION
               bL(i,N(ng))=bR(i,N(ng)-1)
@@ -554,7 +575,7 @@
 !  inside the grid box.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=bR(i,k)-qc(i,k)
                 dltL=qc(i,k)-bL(i,k)
                 cffR=2.0_r8*dltR
@@ -588,7 +609,7 @@
 !
             cff=dtdays*ABS(Wbio(isink))
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k-1)=0.0_r8
                 WL(i,k)=z_w(i,j,k-1)+cff
                 WR(i,k)=Hz(i,j,k)*qc(i,k)
@@ -597,7 +618,7 @@
             END DO
             DO k=1,N(ng)
               DO ks=k,N(ng)-1
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   IF (WL(i,k).gt.z_w(i,j,ks)) THEN
                     ksource(i,k)=ks+1
                     FC(i,k-1)=FC(i,k-1)+WR(i,ks)
@@ -609,7 +630,7 @@
 !  Finalize computation of flux: add fractional part.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 ks=ksource(i,k)
                 cu=MIN(1.0_r8,(WL(i,k)-z_w(i,j,ks-1))*Hz_inv(i,ks))
                 FC(i,k-1)=FC(i,k-1)+                                    &
@@ -622,7 +643,7 @@
               END DO
             END DO
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio(i,k,ibio)=qc(i,k)+(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
               END DO
             END DO
@@ -648,7 +669,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
               t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff*Hz(i,j,k)
             END DO
@@ -68,6 +68,10 @@
       CALL npzd_iron_tile (ng, tile,                                    &
      &                     LBi, UBi, LBj, UBj, N(ng), NT(ng),           &
      &                     IminS, ImaxS, JminS, JmaxS,                  &
+#ifdef WET_POINTS
+     &                     GRID(ng) % IwetR,                            &
+     &                     GRID(ng) % NwetR,                            &
+#endif
      &                     nstp(ng), nnew(ng),                          &
 #ifdef MASKING
      &                     GRID(ng) % rmask,                            &
@@ -92,6 +96,9 @@
       SUBROUTINE npzd_iron_tile (ng, tile,                              &
      &                           LBi, UBi, LBj, UBj, UBk, UBt,          &
      &                           IminS, ImaxS, JminS, JmaxS,            &
+#ifdef WET_POINTS
+     &                           IwetR, NwetR,                          &
+#endif
      &                           nstp, nnew,                            &
 #ifdef MASKING
      &                           rmask,                                 &
@@ -117,6 +124,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 # endif
@@ -127,8 +138,12 @@
       real(r8), intent(in) :: z_r(LBi:,LBj:,:)
       real(r8), intent(in) :: z_w(LBi:,LBj:,0:)
       real(r8), intent(in) :: srflx(LBi:,LBj:)
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 # endif
@@ -139,11 +154,14 @@
       real(r8), intent(in) :: z_r(LBi:UBi,LBj:UBj,UBk)
       real(r8), intent(in) :: z_w(LBi:UBi,LBj:UBj,0:UBk)
       real(r8), intent(in) :: srflx(LBi:UBi,LBj:UBj)
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer, parameter :: Nsink = 2
 
       integer :: Iter, i, ibio, isink, itime, itrc, iTrcMax, j, k, ks
@@ -230,18 +248,21 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
         DO k=1,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv2(i,k)=1.0_r8/(Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
         DO k=2,N(ng)-1
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv3(i,k)=1.0_r8/(Hz(i,j,k-1)+Hz(i,j,k)+Hz(i,j,k+1))
           END DO
         END DO
@@ -252,7 +273,7 @@
 !  which is set to 1E-6 above.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
 !
 !  At input, all tracers (index nnew) from predictor step have
 !  transport units (m Tunits) since we do not have yet the new
@@ -320,7 +341,7 @@
 !  net shortwave radiation is scaled back to Watts/m2 and multiplied by
 !  the fraction that is photosynthetically available, PARfrac.
 !
-        DO i=Istr,Iend
+        DO_WET_I(j)
 #ifdef CONST_PAR
 !
 !  Specify constant surface irradiance a la Powell and Spitz.
@@ -389,7 +410,7 @@
 !
 !  Compute light attenuation as function of depth.
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
             PAR=PARsur(i)
             IF (PARsur(i).gt.0.0_r8) THEN              ! day time
               DO k=N(ng),1,-1
@@ -439,7 +460,7 @@
           cff2=Vm_NO3(ng)*Vm_NO3(ng)
           cff3=PhyIS(ng)*PhyIS(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
 #ifdef IRON_LIMIT
 !
 !  Calculate growth reduction factor due to iron limitation.
@@ -505,7 +526,7 @@
           cff1=dtdays*ZooGR(ng)
           cff2=1.0_r8-ZooEEN(ng)-ZooEED(ng)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,iZoop)*                                       &
      &            cff1*(1.0_r8-EXP(-Ivlev(ng)*Bio(i,k,iPhyt)))/         &
      &            Bio(i,k,iPhyt)
@@ -531,7 +552,7 @@
           cff2=dtdays*PhyMRN(ng)
           cff1=1.0_r8/(1.0_r8+cff2+cff3)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iPhyt)=Bio(i,k,iPhyt)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iPhyt)*cff2
@@ -552,7 +573,7 @@
           cff2=dtdays*ZooMRN(ng)
           cff1=1.0_r8/(1.0_r8+cff2+cff3)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iZoop)=Bio(i,k,iZoop)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iZoop)*cff2
@@ -566,7 +587,7 @@
           cff2=dtdays*DetRR(ng)
           cff1=1.0_r8/(1.0_r8+cff2)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio(i,k,iSDet)=Bio(i,k,iSDet)*cff1
               Bio(i,k,iNO3_)=Bio(i,k,iNO3_)+                            &
      &                       Bio(i,k,iSDet)*cff2
@@ -590,18 +611,18 @@
 !  constituent concentration.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 qc(i,k)=Bio(i,k,ibio)
               END DO
             END DO
 !
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(qc(i,k+1)-qc(i,k))*Hz_inv2(i,k)
               END DO
             END DO
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=Hz(i,j,k)*FC(i,k)
                 dltL=Hz(i,j,k)*FC(i,k-1)
                 cff=Hz(i,j,k-1)+2.0_r8*Hz(i,j,k)+Hz(i,j,k+1)
@@ -640,14 +661,14 @@
             END DO
             cff=1.0E-14_r8
             DO k=2,N(ng)-2
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltL=MAX(cff,WL(i,k  ))
                 dltR=MAX(cff,WR(i,k+1))
                 bR(i,k)=(dltR*bR(i,k)+dltL*bL(i,k+1))/(dltR+dltL)
                 bL(i,k+1)=bR(i,k)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,N(ng))=0.0_r8            ! NO-flux boundary condition
 #if defined LINEAR_CONTINUATION
               bL(i,N(ng))=bR(i,N(ng)-1)
@@ -678,7 +699,7 @@
 !  inside the grid box.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 dltR=bR(i,k)-qc(i,k)
                 dltL=qc(i,k)-bL(i,k)
                 cffR=2.0_r8*dltR
@@ -712,7 +733,7 @@
 !
             cff=dtdays*ABS(Wbio(isink))
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k-1)=0.0_r8
                 WL(i,k)=z_w(i,j,k-1)+cff
                 WR(i,k)=Hz(i,j,k)*qc(i,k)
@@ -721,7 +742,7 @@
             END DO
             DO k=1,N(ng)
               DO ks=k,N(ng)-1
-                DO i=Istr,Iend
+                DO_WET_I(j)
                   IF (WL(i,k).gt.z_w(i,j,ks)) THEN
                     ksource(i,k)=ks+1
                     FC(i,k-1)=FC(i,k-1)+WR(i,ks)
@@ -733,7 +754,7 @@
 !  Finalize computation of flux: add fractional part.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 ks=ksource(i,k)
                 cu=MIN(1.0_r8,(WL(i,k)-z_w(i,j,ks-1))*Hz_inv(i,ks))
                 FC(i,k-1)=FC(i,k-1)+                                    &
@@ -746,7 +767,7 @@
               END DO
             END DO
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 Bio(i,k,ibio)=qc(i,k)+(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
               END DO
             END DO
@@ -772,7 +793,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
               t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff*Hz(i,j,k)
             END DO
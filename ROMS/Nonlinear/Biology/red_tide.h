@@ -76,6 +76,10 @@
       CALL red_tide_tile (ng, tile,                                     &
      &                    LBi, UBi, LBj, UBj, N(ng), NT(ng),            &
      &                    IminS, ImaxS, JminS, JmaxS,                   &
+#ifdef WET_POINTS
+     &                    GRID(ng) % IwetR,                             &
+     &                    GRID(ng) % NwetR,                             &
+#endif
      &                    nstp(ng), nnew(ng),                           &
 #ifdef MASKING
      &                    GRID(ng) % rmask,                             &
@@ -102,6 +106,9 @@
       SUBROUTINE red_tide_tile (ng, tile,                               &
      &                          LBi, UBi, LBj, UBj, UBk, UBt,           &
      &                          IminS, ImaxS, JminS, JmaxS,             &
+#ifdef WET_POINTS
+     &                          IwetR, NwetR,                           &
+#endif
      &                          nstp, nnew,                             &
 #ifdef MASKING
      &                          rmask,                                  &
@@ -129,6 +136,10 @@
       integer, intent(in) :: nstp, nnew
 
 #ifdef ASSUMED_SHAPE
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:,LBj:)
+      integer, intent(in) :: NwetR(LBi:,LBj:)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:,LBj:)
 # endif
@@ -141,8 +152,12 @@
       real(r8), intent(in) :: srflx_avg(LBi:,LBj:)
 # endif
       real(r8), intent(in) :: srflx(LBi:,LBj:)
-      real(r8), intent(inout) :: t(LBi:,LBj:,:,:,:)
+      real(rsp), intent(inout) :: t(LBi:,LBj:,:,:,:)
 #else
+# ifdef WET_POINTS
+      integer, intent(in) :: IwetR(LBi:UBi,LBj:UBj)
+      integer, intent(in) :: NwetR(LBi:UBi,LBj:UBj)
+# endif
 # ifdef MASKING
       real(r8), intent(in) :: rmask(LBi:UBi,LBj:UBj)
 # endif
@@ -155,11 +170,14 @@
 # endif
       real(r8), intent(in) :: srflx(LBi:UBi,LBj:UBj)
       real(r8), intent(in) :: DIN_ob(LBi:UBi,LBj:UBj,UBk)
-      real(r8), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
+      real(rsp), intent(inout) :: t(LBi:UBi,LBj:UBj,UBk,3,UBt)
 #endif
 !
 !  Local variable declarations.
 !
+#ifdef WET_POINTS
+      integer :: IendW, iw
+#endif
       integer, parameter :: Nswim = 1
 
       integer, parameter :: NsedLayers = 10
@@ -260,8 +278,11 @@
 !  Compute inverse thickness to avoid repeated divisions.
 !
       J_LOOP : DO j=Jstr,Jend
+#ifdef WET_POINTS
+        IendW=Istr+NwetR(Iend,j)-1
+#endif
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Hz_inv(i,k)=1.0_r8/Hz(i,j,k)
           END DO
         END DO
@@ -276,7 +297,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               Bio_old(i,k,ibio)=MAX(0.0_r8,t(i,j,k,nstp,ibio))
               Bio(i,k,ibio)=Bio_old(i,k,ibio)
             END DO
@@ -286,7 +307,7 @@
 !  Extract potential temperature and salinity.
 !
         DO k=1,N(ng)
-          DO i=Istr,Iend
+          DO_WET_I(j)
             Bio(i,k,itemp)=MIN(t(i,j,k,nstp,itemp),36.0_r8)
             Bio(i,k,isalt)=MAX(0.0_r8,t(i,j,k,nstp,isalt))
           END DO
@@ -337,7 +358,7 @@
 !  as a function of bottom water temperature and non-spectral
 !  irradiance.
 !
-          DO i=Istr,Iend
+          DO_WET_I(j)
 !
 !  Calculate "light" and "dark" cyst germination rates as a function
 !  of bottom temperature.
@@ -407,7 +428,7 @@
 !  irradiance (light), and nutrient (Dissolved Inorganic Nutrient, DIN).
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               temp=Bio(i,k,itemp)
               salt=Bio(i,k,isalt)
 !
@@ -479,7 +500,7 @@
 !  (implicit).  Use a Q10 mortality rate equation.
 !
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               temp=Bio(i,k,itemp)
               M_rate=Mor_a(ng)*                                         &
      &               Mor_Q10(ng)**((temp-Mor_T0(ng))*0.1_r8)+           &
@@ -500,14 +521,14 @@
           SWIM_LOOP: DO iswim=1,Nswim
             ibio=idswim(iswim)
             DO k=N(ng)-1,1,-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 FC(i,k)=(Bio(i,k+1,ibio)-Bio(i,k,ibio))/                &
      &                  (Hz(i,j,k+1)+Hz(i,j,k))
               END DO
             END DO
 !
             DO k=2,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 deltaR=Hz(i,j,k)*FC(i,k  )
                 deltaL=Hz(i,j,k)*FC(i,k-1)
                 IF (deltaR*deltaL.lt.0.0_r8) THEN
@@ -538,7 +559,7 @@
 ! simply constant within topmost and bottommost grid boxes.
 !
 
-            DO i=Istr,Iend
+            DO_WET_I(j)
               aR(i,N(ng))=Bio(i,N(ng),ibio)
               aL(i,N(ng))=Bio(i,N(ng),ibio)
               dR(i,N(ng))=0.0_r8
@@ -555,7 +576,7 @@
 ! for Neumann conditions, the extrapolate values aR(i,N(ng)) and aL(i,0)
 ! exceed corresponding box values.
 !
-            DO i=Istr,Iend
+            DO_WET_I(j)
               aL(i,N(ng))=aR(i,N(ng)-1)
 # ifdef NEUMANN
               aR(i,N(ng))=1.5_r8*Bio(i,N(ng),ibio)-0.5_r8*aL(i,N(ng))
@@ -584,14 +605,14 @@
 ! Non-Oscillatory (WENO) procedure.
 !
             DO k=1,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 deltaL=MAX(dL(i,k  ),eps)
                 deltaR=MAX(dR(i,k+1),eps)
                 r(i,k)=(deltaR*aR(i,k)+deltaL*aL(i,k+1))/               &
      &                 (deltaR+deltaL)
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
 #ifdef NEUMANN
               r(i,N(ng))=1.5_r8*Bio(i,N(ng),ibio)-0.5_r8*r(i,N(ng)-1)
               r(i,0    )=1.5_r8*Bio(i,1    ,ibio)-0.5_r8*r(i,1      )
@@ -608,7 +629,7 @@
 ! remapping step.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
 #ifdef LIMIT_INTERIOR
                 deltaR=r(i,k)-Bio(i,k,ibio)      ! Constrain parabolic
                 deltaL=Bio(i,k,ibio)-r(i,k-1)    ! segment monotonicity
@@ -639,7 +660,7 @@
 !
             wdt=-Wbio(iswim)*dtdays
             DO k=1,N(ng)-1
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 IF (wdt.gt.0.0_r8) THEN           ! downward vertical
                   alpha=Hz(i,j,k+1)               ! motion (sinking)
                   cff =aL(i,k+1)
@@ -662,7 +683,7 @@
                 FC(i,k)=dz*(cff+alpha*(cffL-cffR*(3.0_r8-2.0_r8*alpha)))
               END DO
             END DO
-            DO i=Istr,Iend
+            DO_WET_I(j)
               FC(i,0    )=0.0_r8
               FC(i,N(ng))=0.0_r8
             END DO
@@ -670,7 +691,7 @@
 !  Add semi-Lagrangian vertical flux.
 !
             DO k=1,N(ng)
-              DO i=Istr,Iend
+              DO_WET_I(j)
                 cff=(FC(i,k)-FC(i,k-1))*Hz_inv(i,k)
                 Bio(i,k,ibio)=Bio(i,k,ibio)+cff
               END DO
@@ -697,7 +718,7 @@
         DO itrc=1,NBT
           ibio=idbio(itrc)
           DO k=1,N(ng)
-            DO i=Istr,Iend
+            DO_WET_I(j)
               cff=Bio(i,k,ibio)-Bio_old(i,k,ibio)
               t(i,j,k,nnew,ibio)=t(i,j,k,nnew,ibio)+cff*Hz(i,j,k)
             END DO
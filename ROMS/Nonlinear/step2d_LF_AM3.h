@@ -8,10 +8,54 @@
 !                                                                      !
 !=======================================================================
 !
+#ifdef WIDE_HALO_2D
+      USE mod_kinds
+!
+#endif
       implicit none
 !
       PRIVATE
       PUBLIC  :: step2d
+#ifdef WIDE_HALO_2D
+!
+!  Wide halo copies of the module arrays used by the barotropic kernel
+!  and its lateral boundary conditions.  They are allocated once with
+!  the wide halo bounds of the extended tiles and swapped with the
+!  module arrays during the barotropic time-steps (see "wide_fields").
+!
+      TYPE T_WIDE
+        real(r8), pointer :: A2d(:,:) => NULL()
+        real(r8), pointer :: A3d(:,:,:) => NULL()
+        real(r8), pointer :: A4d(:,:,:,:) => NULL()
+      END TYPE T_WIDE
+
+      integer, parameter :: MaxWide = 64
+
+      TYPE (T_WIDE), allocatable :: Wcopy(:,:)     ! wide halo copies
+      TYPE (T_WIDE), allocatable :: Wsave(:,:)     ! swapped arrays
+!
+!  Wide halo copy types:
+!
+!    wFixed     time-invariant field, copied and exchanged once.
+!    wInput     field read by the kernel, copied and exchanged before
+!                 the first barotropic time-step.
+!    wState     field updated by the kernel, copied and exchanged
+!                 before the first barotropic time-step and copied
+!                 back after the auxiliary time-step.
+!    wOutput    field computed by the kernel, copied back after the
+!                 auxiliary time-step.
+!
+      integer, parameter :: wFixed  = 1
+      integer, parameter :: wInput  = 2
+      integer, parameter :: wState  = 3
+      integer, parameter :: wOutput = 4
+!
+      INTERFACE wide_swap
+        MODULE PROCEDURE wide_swap2d
+        MODULE PROCEDURE wide_swap3d
+        MODULE PROCEDURE wide_swap4d
+      END INTERFACE wide_swap
+#endif
 !
       CONTAINS
 !
@@ -34,6 +78,11 @@
       USE mod_sedbed
 #endif
       USE mod_stepping
+#ifdef WIDE_HALO_2D
+      USE mod_scalars
+!
+      USE mp_exchange_mod, ONLY : mp_exchange_fields, T_XFIELD
+#endif
 !
 !  Imported variable declarations.
 !
@@ -43,14 +92,84 @@
 !
       character (len=*), parameter :: MyFile =                          &
      &  __FILE__
+#ifdef WIDE_HALO_2D
+!
+      integer :: Nfld, ic, my_tile, Wtile
+      integer :: WLBi, WUBi, WLBj, WUBj
+
+      TYPE (T_XFIELD) :: Fxch(MaxWide)
+#endif
 !
 #include "tile.h"
 !
 #ifdef PROFILE
       CALL wclock_on (ng, iNLM, 9, __LINE__, MyFile)
 #endif
+#ifdef WIDE_HALO_2D
+!
+!  Communication-avoiding barotropic time-stepping. The fast-time fields
+!  are exchanged every NfastHalo time-steps in a halo region, NwideHalo
+!  points wide, that holds the redundant computations of the tile halo
+!  points in between.  Each predictor or corrector step consumes four
+!  halo points, so the step is computed in the tile extended by the
+!  number of halo points that are still valid after the step.  The
+!  extended tile bounds are set in "inp_par" and stored after the tile
+!  partition.  Only the tile sides that are not domain boundary edges
+!  are extended.
+!
+!  The state arrays keep the allocation bounds of the tile.  Before the
+!  first barotropic time-step, the module arrays used by the kernel are
+!  swapped with wide halo copies, dimensioned with the allocation bounds
+!  of the extended tiles, which are exchanged in the wide halo.  The
+!  time-invariant fields are only exchanged the first time.  The fields
+!  updated by the kernel are copied back and the module arrays restored
+!  after the auxiliary time-step.
+!
+      Wtile=NtileI(ng)*NtileJ(ng)
+# ifdef FUSED_KERNELS
+      Wtile=Wtile+NstripJ(ng)
+# endif
+      WLBi=BOUNDS(ng) % LBi(Wtile)
+      WUBi=BOUNDS(ng) % UBi(Wtile)
+      WLBj=BOUNDS(ng) % LBj(Wtile)
+      WUBj=BOUNDS(ng) % UBj(Wtile)
+!
+      IF (FIRST_2D_STEP.and.PREDICTOR_2D_STEP(ng)) THEN
+        Nfld=0
+        CALL wide_fields (ng, .TRUE., WLBi, WUBi, WLBj, WUBj,           &
+     &                    Nfld, Fxch)
+        CALL mp_exchange_fields (ng, tile, iNLM, Nfld,                  &
+     &                           WLBi, WUBi, WLBj, WUBj,                &
+     &                           NwideHalo(ng),                         &
+     &                           EWperiodic(ng), NSperiodic(ng),        &
+     &                           Fxch(1:Nfld))
+      END IF
+!
+!  Select the extended tile for the ic-th predictor or corrector step
+!  of the exchange cycle.  The last corrector step of the cycle and the
+!  auxiliary step are computed in the tile.
+!
+      my_tile=tile
+      IF (iif(ng).le.nfast(ng)) THEN
+        ic=2*MOD(iif(ng)-1,NfastHalo(ng))
+        IF (.not.PREDICTOR_2D_STEP(ng)) ic=ic+1
+        IF (ic.lt.2*NfastHalo(ng)-1) THEN
+          my_tile=Wtile+ic
+          IminS=BOUNDS(ng) % Istr(my_tile)-3
+          ImaxS=BOUNDS(ng) % Iend(my_tile)+3
+          JminS=BOUNDS(ng) % Jstr(my_tile)-3
+          JmaxS=BOUNDS(ng) % Jend(my_tile)+3
+        END IF
+      END IF
+!
+!  Only the vertically integrated level of "ru" and "rv" is copied.
+!
+      CALL step2d_tile (ng, my_tile,                                    &
+     &                  WLBi, WUBi, WLBj, WUBj, 0,                      &
+#else
       CALL step2d_tile (ng, tile,                                       &
      &                  LBi, UBi, LBj, UBj, N(ng),                      &
+#endif
      &                  IminS, ImaxS, JminS, JmaxS,                     &
      &                  krhs(ng), kstp(ng), knew(ng),                   &
 #ifdef SOLVE3D
@@ -126,12 +245,478 @@
      &                  OCEAN(ng) % rzeta,                              &
      &                  OCEAN(ng) % ubar,       OCEAN(ng) % vbar,       &
      &                  OCEAN(ng) % zeta)
+#ifdef WIDE_HALO_2D
+!
+!  Exchange the fast-time fields in the wide halo after the corrector
+!  step that ends the exchange cycle or at the last barotropic
+!  time-step.  All the time levels are exchanged since the time-stepping
+!  scheme uses the previous time-step values.
+!
+      IF (.not.PREDICTOR_2D_STEP(ng).and.                               &
+     &    ((MOD(iif(ng),NfastHalo(ng)).eq.0).or.                        &
+     &     (iif(ng).eq.nfast(ng)))) THEN
+        Nfld=0
+        CALL wide_field (Nfld, Fxch, WLBi, WLBj, OCEAN(ng) % zeta)
+        CALL wide_field (Nfld, Fxch, WLBi, WLBj, OCEAN(ng) % ubar)
+        CALL wide_field (Nfld, Fxch, WLBi, WLBj, OCEAN(ng) % vbar)
+        CALL wide_field (Nfld, Fxch, WLBi, WLBj, OCEAN(ng) % rzeta)
+        CALL wide_field (Nfld, Fxch, WLBi, WLBj, OCEAN(ng) % rubar)
+        CALL wide_field (Nfld, Fxch, WLBi, WLBj, OCEAN(ng) % rvbar)
+        CALL mp_exchange_fields (ng, tile, iNLM, Nfld,                  &
+     &                           WLBi, WUBi, WLBj, WUBj,                &
+     &                           NwideHalo(ng),                         &
+     &                           EWperiodic(ng), NSperiodic(ng),        &
+     &                           Fxch(1:Nfld))
+      END IF
+!
+!  Copy the fields updated by the kernel back to the module arrays after
+!  the auxiliary time-step.
+!
+      IF (iif(ng).eq.(nfast(ng)+1)) THEN
+        Nfld=0
+        CALL wide_fields (ng, .FALSE., WLBi, WUBi, WLBj, WUBj,          &
+     &                    Nfld, Fxch)
+      END IF
+#endif
 #ifdef PROFILE
       CALL wclock_off (ng, iNLM, 9, __LINE__, MyFile)
 #endif
 !
       RETURN
       END SUBROUTINE step2d
+#ifdef WIDE_HALO_2D
+!
+!***********************************************************************
+      SUBROUTINE wide_fields (ng, Lswap, LBi, UBi, LBj, UBj, Nfld, F)
+!***********************************************************************
+!
+!  Swaps the module arrays used by the barotropic kernel and its lateral
+!  boundary conditions with their wide halo copies (Lswap=.TRUE.), or
+!  restores them (Lswap=.FALSE.).  The copies that need to be exchanged
+!  in the wide halo are appended to the exchange descriptors "F".  The
+!  arrays must be processed in the same order in both calls.
+!
+      USE mod_param
+      USE mod_clima
+      USE mod_coupling
+      USE mod_forces
+      USE mod_grid
+#if defined UV_VIS2 || defined UV_VIS4 || defined NEARSHORE_MELLOR
+      USE mod_mixing
+#endif
+      USE mod_ocean
+      USE mod_scalars
+!
+      USE mp_exchange_mod, ONLY : T_XFIELD
+!
+!  Imported variable declarations.
+!
+      logical, intent(in) :: Lswap
+!
+      integer, intent(in) :: ng, LBi, UBi, LBj, UBj
+      integer, intent(inout) :: Nfld
+!
+      TYPE (T_XFIELD), intent(inout) :: F(:)
+!
+!  Local variable declarations.
+!
+      integer :: nw
+!
+!-----------------------------------------------------------------------
+!  Allocate wide halo copies structure.
+!-----------------------------------------------------------------------
+!
+      IF (.not.allocated(Wcopy)) THEN
+        allocate ( Wcopy(MaxWide,Ngrids) )
+        allocate ( Wsave(MaxWide,Ngrids) )
+      END IF
+!
+!-----------------------------------------------------------------------
+!  Time-invariant grid fields.
+!-----------------------------------------------------------------------
+!
+      nw=0
+# ifdef MASKING
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pmask)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % rmask)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % umask)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % vmask)
+# endif
+# ifdef UV_COR
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % f)
+# endif
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % fomn)
+# ifndef SED_MORPH
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % h)
+# endif
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % om_u)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % om_v)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % on_u)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % on_v)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % omn)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pm)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pn)
+# if defined CURVGRID && defined UV_ADV
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % dndx)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % dmde)
+# endif
+# if defined UV_VIS2 || defined UV_VIS4
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pmon_r)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pnom_r)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pmon_p)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % pnom_p)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % om_r)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % on_r)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % om_p)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % on_p)
+#  ifdef UV_VIS2
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, MIXING(ng) % visc2_p)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, MIXING(ng) % visc2_r)
+#  endif
+#  ifdef UV_VIS4
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, MIXING(ng) % visc4_p)
+      CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, MIXING(ng) % visc4_r)
+#  endif
+# endif
+      IF (LnudgeM2CLM(ng)) THEN
+        CALL wide_swap (ng, nw, Lswap, wFixed, LBi, UBi, LBj, UBj,      &
+     &                  Nfld, F, CLIMA(ng) % M2nudgcof)
+      END IF
+!
+!-----------------------------------------------------------------------
+!  Fields updated by the 3D kernels and the forcing.
+!-----------------------------------------------------------------------
+!
+# ifdef SED_MORPH
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, GRID(ng) % h)
+# endif
+# ifdef VAR_RHO_2D
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, COUPLING(ng) % rhoA)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, COUPLING(ng) % rhoS)
+# endif
+# ifdef NEARSHORE_MELLOR
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, MIXING(ng) % rustr2d)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, MIXING(ng) % rvstr2d)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % rulag2d)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % rvlag2d)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % ubar_stokes)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % vbar_stokes)
+# endif
+      IF (LnudgeM2CLM(ng)) THEN
+        CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,      &
+     &                  Nfld, F, CLIMA(ng) % ubarclm)
+        CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,      &
+     &                  Nfld, F, CLIMA(ng) % vbarclm)
+      END IF
+!
+!  Surface and bottom stresses and atmospheric pressure used by the
+!  Flather and reduced physics lateral boundary conditions.
+!
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, FORCES(ng) % sustr)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, FORCES(ng) % svstr)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, FORCES(ng) % bustr)
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, FORCES(ng) % bvstr)
+# if defined ATM_PRESS && defined PRESS_COMPENSATE
+      CALL wide_swap (ng, nw, Lswap, wInput, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, FORCES(ng) % Pair)
+# endif
+!
+!-----------------------------------------------------------------------
+!  Barotropic state and 2D/3D coupling fields.
+!-----------------------------------------------------------------------
+!
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % zeta)
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % ubar)
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % vbar)
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, COUPLING(ng) % rufrc)
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, COUPLING(ng) % rvfrc)
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % ru)
+      CALL wide_swap (ng, nw, Lswap, wState, LBi, UBi, LBj, UBj,        &
+     &                Nfld, F, OCEAN(ng) % rv)
+!
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, OCEAN(ng) % rzeta)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, OCEAN(ng) % rubar)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, OCEAN(ng) % rvbar)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, COUPLING(ng) % DU_avg1)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, COUPLING(ng) % DU_avg2)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, COUPLING(ng) % DV_avg1)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, COUPLING(ng) % DV_avg2)
+      CALL wide_swap (ng, nw, Lswap, wOutput, LBi, UBi, LBj, UBj,       &
+     &                Nfld, F, COUPLING(ng) % Zt_avg1)
+!
+      RETURN
+      END SUBROUTINE wide_fields
+!
+!***********************************************************************
+      SUBROUTINE wide_swap2d (ng, nw, Lswap, wtype, LBi, UBi, LBj, UBj, &
+     &                        Nfld, F, A)
+!***********************************************************************
+!
+!  Swaps 2D module array "A" with its nw-th wide halo copy, or restores
+!  it.  The copy is allocated with the wide halo bounds the first time.
+!
+      USE mp_exchange_mod, ONLY : mp_field, T_XFIELD
+!
+!  Imported variable declarations.
+!
+      logical, intent(in) :: Lswap
+!
+      integer, intent(in) :: ng, wtype, LBi, UBi, LBj, UBj
+      integer, intent(inout) :: nw, Nfld
+!
+      real(r8), pointer :: A(:,:)
+!
+      TYPE (T_XFIELD), intent(inout) :: F(:)
+!
+!  Local variable declarations.
+!
+      logical :: Lfirst
+!
+      integer :: Imin, Imax, Jmin, Jmax
+!
+      nw=nw+1
+      IF (Lswap) THEN
+        Lfirst=.not.ASSOCIATED(Wcopy(nw,ng)%A2d)
+        IF (Lfirst) THEN
+          allocate ( Wcopy(nw,ng)%A2d(LBi:UBi,LBj:UBj) )
+          Wcopy(nw,ng)%A2d=0.0_r8
+        END IF
+        Imin=LBOUND(A,1)
+        Imax=UBOUND(A,1)
+        Jmin=LBOUND(A,2)
+        Jmax=UBOUND(A,2)
+        Wsave(nw,ng)%A2d => A
+        IF (Lfirst.or.(wtype.ne.wFixed)) THEN
+          Wcopy(nw,ng)%A2d(Imin:Imax,Jmin:Jmax)=A(Imin:Imax,Jmin:Jmax)
+          IF (wtype.ne.wOutput) THEN
+            Nfld=Nfld+1
+            CALL mp_field (F(Nfld), LBi, LBj, Wcopy(nw,ng)%A2d)
+          END IF
+        END IF
+        A => Wcopy(nw,ng)%A2d
+      ELSE
+        Imin=LBOUND(Wsave(nw,ng)%A2d,1)
+        Imax=UBOUND(Wsave(nw,ng)%A2d,1)
+        Jmin=LBOUND(Wsave(nw,ng)%A2d,2)
+        Jmax=UBOUND(Wsave(nw,ng)%A2d,2)
+        IF ((wtype.eq.wState).or.(wtype.eq.wOutput)) THEN
+          Wsave(nw,ng)%A2d(Imin:Imax,Jmin:Jmax)=A(Imin:Imax,Jmin:Jmax)
+        END IF
+        A => Wsave(nw,ng)%A2d
+      END IF
+!
+      RETURN
+      END SUBROUTINE wide_swap2d
+!
+!***********************************************************************
+      SUBROUTINE wide_swap3d (ng, nw, Lswap, wtype, LBi, UBi, LBj, UBj, &
+     &                        Nfld, F, A)
+!***********************************************************************
+!
+!  Swaps 3D module array "A", all time levels, with its nw-th wide halo
+!  copy, or restores it.
+!
+      USE mp_exchange_mod, ONLY : mp_field, T_XFIELD
+!
+!  Imported variable declarations.
+!
+      logical, intent(in) :: Lswap
+!
+      integer, intent(in) :: ng, wtype, LBi, UBi, LBj, UBj
+      integer, intent(inout) :: nw, Nfld
+!
+      real(r8), pointer :: A(:,:,:)
+!
+      TYPE (T_XFIELD), intent(inout) :: F(:)
+!
+!  Local variable declarations.
+!
+      logical :: Lfirst
+!
+      integer :: Imin, Imax, Jmin, Jmax, Kmin, Kmax
+!
+      nw=nw+1
+      IF (Lswap) THEN
+        Kmin=LBOUND(A,3)
+        Kmax=UBOUND(A,3)
+        Lfirst=.not.ASSOCIATED(Wcopy(nw,ng)%A3d)
+        IF (Lfirst) THEN
+          allocate ( Wcopy(nw,ng)%A3d(LBi:UBi,LBj:UBj,Kmin:Kmax) )
+          Wcopy(nw,ng)%A3d=0.0_r8
+        END IF
+        Imin=LBOUND(A,1)
+        Imax=UBOUND(A,1)
+        Jmin=LBOUND(A,2)
+        Jmax=UBOUND(A,2)
+        Wsave(nw,ng)%A3d => A
+        IF (Lfirst.or.(wtype.ne.wFixed)) THEN
+          Wcopy(nw,ng)%A3d(Imin:Imax,Jmin:Jmax,:)=                      &
+     &                   A(Imin:Imax,Jmin:Jmax,:)
+          IF (wtype.ne.wOutput) THEN
+            Nfld=Nfld+1
+            CALL mp_field (F(Nfld), LBi, LBj, Wcopy(nw,ng)%A3d)
+          END IF
+        END IF
+        A => Wcopy(nw,ng)%A3d
+      ELSE
+        Imin=LBOUND(Wsave(nw,ng)%A3d,1)
+        Imax=UBOUND(Wsave(nw,ng)%A3d,1)
+        Jmin=LBOUND(Wsave(nw,ng)%A3d,2)
+        Jmax=UBOUND(Wsave(nw,ng)%A3d,2)
+        IF ((wtype.eq.wState).or.(wtype.eq.wOutput)) THEN
+          Wsave(nw,ng)%A3d(Imin:Imax,Jmin:Jmax,:)=                      &
+     &                   A(Imin:Imax,Jmin:Jmax,:)
+        END IF
+        A => Wsave(nw,ng)%A3d
+      END IF
+!
+      RETURN
+      END SUBROUTINE wide_swap3d
+!
+!***********************************************************************
+      SUBROUTINE wide_swap4d (ng, nw, Lswap, wtype, LBi, UBi, LBj, UBj, &
+     &                        Nfld, F, A)
+!***********************************************************************
+!
+!  Swaps the vertically integrated level (k=0) of 4D module array "A",
+!  like "ru" and "rv", with its nw-th wide halo copy, or restores it.
+!  The copy only holds level zero of all the time levels.
+!
+      USE mp_exchange_mod, ONLY : mp_field, T_XFIELD
+!
+!  Imported variable declarations.
+!
+      logical, intent(in) :: Lswap
+!
+      integer, intent(in) :: ng, wtype, LBi, UBi, LBj, UBj
+      integer, intent(inout) :: nw, Nfld
+!
+      real(r8), pointer :: A(:,:,:,:)
+!
+      TYPE (T_XFIELD), intent(inout) :: F(:)
+!
+!  Local variable declarations.
+!
+      logical :: Lfirst
+!
+      integer :: Imin, Imax, Jmin, Jmax, Lmin, Lmax
+!
+      nw=nw+1
+      IF (Lswap) THEN
+        Lmin=LBOUND(A,4)
+        Lmax=UBOUND(A,4)
+        Lfirst=.not.ASSOCIATED(Wcopy(nw,ng)%A4d)
+        IF (Lfirst) THEN
+          allocate ( Wcopy(nw,ng)%A4d(LBi:UBi,LBj:UBj,0:0,Lmin:Lmax) )
+          Wcopy(nw,ng)%A4d=0.0_r8
+        END IF
+        Imin=LBOUND(A,1)
+        Imax=UBOUND(A,1)
+        Jmin=LBOUND(A,2)
+        Jmax=UBOUND(A,2)
+        Wsave(nw,ng)%A4d => A
+        IF (Lfirst.or.(wtype.ne.wFixed)) THEN
+          Wcopy(nw,ng)%A4d(Imin:Imax,Jmin:Jmax,0,:)=                    &
+     &                   A(Imin:Imax,Jmin:Jmax,0,:)
+          IF (wtype.ne.wOutput) THEN
+            Nfld=Nfld+1
+            CALL mp_field (F(Nfld), LBi, LBj, Wcopy(nw,ng)%A4d)
+          END IF
+        END IF
+        A => Wcopy(nw,ng)%A4d
+      ELSE
+        Imin=LBOUND(Wsave(nw,ng)%A4d,1)
+        Imax=UBOUND(Wsave(nw,ng)%A4d,1)
+        Jmin=LBOUND(Wsave(nw,ng)%A4d,2)
+        Jmax=UBOUND(Wsave(nw,ng)%A4d,2)
+        IF ((wtype.eq.wState).or.(wtype.eq.wOutput)) THEN
+          Wsave(nw,ng)%A4d(Imin:Imax,Jmin:Jmax,0,:)=                    &
+     &                   A(Imin:Imax,Jmin:Jmax,0,:)
+        END IF
+        A => Wsave(nw,ng)%A4d
+      END IF
+!
+      RETURN
+      END SUBROUTINE wide_swap4d
+!
+!***********************************************************************
+      SUBROUTINE wide_field (Nfld, F, LBi, LBj, A)
+!***********************************************************************
+!
+!  Appends 3D tiled array "A" (all time levels) to the wide halo
+!  exchange descriptors "F".
+!
+      USE mp_exchange_mod, ONLY : mp_field, T_XFIELD
+!
+!  Imported variable declarations.
+!
+      integer, intent(in) :: LBi, LBj
+      integer, intent(inout) :: Nfld
+!
+      real(r8), intent(inout), target :: A(LBi:,LBj:,:)
+!
+      TYPE (T_XFIELD), intent(inout) :: F(:)
+!
+      Nfld=Nfld+1
+      CALL mp_field (F(Nfld), LBi, LBj, A)
+!
+      RETURN
+      END SUBROUTINE wide_field
+#endif
 !
 !***********************************************************************
       SUBROUTINE step2d_tile (ng, tile,                                 &
@@ -210,10 +795,18 @@
       USE mod_sediment
 #endif
       USE mod_sources
+#ifdef WIDE_HALO_2D
+      USE mod_parallel, ONLY : MyTile
+#endif
 !
       USE exchange_2d_mod
 #ifdef DISTRIBUTE
       USE mp_exchange_mod, ONLY : mp_exchange2d
+# ifndef WIDE_HALO_2D
+      USE mp_exchange_mod, ONLY : mp_exchange2d_start,                  &
+     &                            mp_exchange2d_finish,                 &
+     &                            T_EXCHANGE
+# endif
 #endif
       USE obc_volcons_mod, ONLY : obc_flux_tile, set_DUV_bc_tile
       USE u2dbc_mod,       ONLY : u2dbc_tile
@@ -453,6 +1046,10 @@
 #ifdef DIAGNOSTICS_UV
       integer :: idiag
 #endif
+#if defined DISTRIBUTE && !defined WIDE_HALO_2D
+!
+      TYPE (T_EXCHANGE), pointer :: Xrzeta
+#endif
 !
       real(r8) :: cff, cff1, cff2, cff3, cff4, cff5, cff6, cff7
       real(r8) :: fac, fac1, fac2, fac3
@@ -506,7 +1103,7 @@
 !  Compute total depth (m) and vertically integrated mass fluxes.
 !-----------------------------------------------------------------------
 !
-#if defined DISTRIBUTE && !defined NESTING
+#if defined DISTRIBUTE && !defined NESTING && !defined WIDE_HALO_2D
 
 !  In distributed-memory, the I- and J-ranges are different and a
 !  special exchange is done to avoid having three ghost points for
@@ -573,7 +1170,7 @@
         END DO
       END DO
 #endif
-#ifdef DISTRIBUTE
+#if defined DISTRIBUTE && !defined WIDE_HALO_2D
 !
       IF (EWperiodic(ng).or.NSperiodic(ng)) THEN
         CALL exchange_u2d_tile (ng, tile,                               &
@@ -880,12 +1477,16 @@
      &                            LBi, UBi, LBj, UBj,                   &
      &                            rzeta(:,:,krhs))
         END IF
-#ifdef DISTRIBUTE
-        CALL mp_exchange2d (ng, tile, iNLM, 1,                          &
-     &                      LBi, UBi, LBj, UBj,                         &
-     &                      NghostPoints,                               &
-     &                      EWperiodic(ng), NSperiodic(ng),             &
-     &                      rzeta(:,:,krhs))
+#if defined DISTRIBUTE && !defined WIDE_HALO_2D
+!
+!  The right-hand-side term is not used again in this step, so start
+!  its halo exchange here and complete it at the end of the routine.
+!
+        CALL mp_exchange2d_start (ng, tile, iNLM, 1,                    &
+     &                            LBi, UBi, LBj, UBj,                   &
+     &                            NghostPoints,                         &
+     &                            EWperiodic(ng), NSperiodic(ng),       &
+     &                            Xrzeta, rzeta(:,:,krhs))
 #endif
       END IF
 !
@@ -920,7 +1521,7 @@
      &                          LBi, UBi, LBj, UBj,                     &
      &                          zeta(:,:,knew))
       END IF
-#ifdef DISTRIBUTE
+#if defined DISTRIBUTE && !defined WIDE_HALO_2D
       CALL mp_exchange2d (ng, tile, iNLM, 1,                            &
      &                    LBi, UBi, LBj, UBj,                           &
      &                    NghostPoints,                                 &
@@ -2461,9 +3062,17 @@
 !
 !  Compute integral mass flux across open boundaries and adjust
 !  for volume conservation.
+#ifdef WIDE_HALO_2D
+!  The flux is integrated over the tile, not the extended tile, so
+!  the boundary points in the wide halo are not counted twice.
+#endif
 !
       IF (ANY(VolCons(:,ng))) THEN
+#ifdef WIDE_HALO_2D
+        CALL obc_flux_tile (ng, MyTile,                                 &
+#else
         CALL obc_flux_tile (ng, tile,                                   &
+#endif
      &                      LBi, UBi, LBj, UBj,                         &
      &                      IminS, ImaxS, JminS, JmaxS,                 &
      &                      knew,                                       &
@@ -2515,13 +3124,19 @@
      &                          vbar(:,:,knew))
       END IF
 
-#ifdef DISTRIBUTE
+#if defined DISTRIBUTE && !defined WIDE_HALO_2D
       CALL mp_exchange2d (ng, tile, iNLM, 2,                            &
      &                    LBi, UBi, LBj, UBj,                           &
      &                    NghostPoints,                                 &
      &                    EWperiodic(ng), NSperiodic(ng),               &
      &                    ubar(:,:,knew),                               &
      &                    vbar(:,:,knew))
+!
+      IF (PREDICTOR_2D_STEP(ng)) THEN
+        CALL mp_exchange2d_finish (ng, tile, iNLM,                      &
+     &                             LBi, UBi, LBj, UBj,                  &
+     &                             Xrzeta, rzeta(:,:,krhs))
+      END IF
 #endif
 !
       RETURN